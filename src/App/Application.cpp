@@ -90,6 +90,7 @@
 #include <Base/ProgressIndicatorPy.h>
 #include <Base/RotationPy.h>
 #include <Base/UniqueNameManager.h>
+#include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 #include <Base/Translate.h>
 #include <Base/Type.h>
@@ -152,6 +153,7 @@
 // scriptings (scripts are built-in but can be overridden by command line option)
 #include <App/InitScript.h>
 #include <App/TestScript.h>
+#include <App/ServerScript.h>
 #include <App/CMakeScript.h>
 
 #include "SafeMode.h"
@@ -1964,10 +1966,20 @@ void Application::init(int argc, char ** argv)
 #if defined(FC_SE_TRANSLATOR)
         _set_se_translator(my_se_translator_filter);
 #endif
+        Base::TimeElapsed startTypes;
         initTypes();
 
+        Base::TimeElapsed startConfig;
         initConfig(argc,argv);
+
+        Base::TimeElapsed startApplication;
         initApplication();
+
+        // the log observers are only set up by initConfig()
+        Base::Console().Log("Init: types %s s, config %s s, application %s s\n",
+                            Base::TimeElapsed::diffTime(startTypes, startConfig),
+                            Base::TimeElapsed::diffTime(startConfig, startApplication),
+                            Base::TimeElapsed::diffTime(startApplication));
     }
     catch (...) {
         // force the log to flush
@@ -2279,6 +2291,8 @@ void parseProgramOptions(int ac, char ** av, const string& exe, variables_map& v
     ("python-path,P", value< vector<string> >()->composing(),"Additional python paths")
     ("disable-addon", value< vector<string> >()->composing(),"Disable a given addon.")
     ("single-instance", "Allow to run a single instance of the application")
+    ("server", value<string>()->implicit_value("-"), "Keep running and execute jobs read from stdin or, if a path is given, from a local socket")
+    ("workers", value<int>(), "Number of forked worker processes accepting jobs on the server socket")
     ("safe-mode", "Force enable safe mode")
     ("pass", value< vector<string> >()->multitoken(), "Ignores the following arguments and pass them through to be used by a script")
     ;
@@ -2534,6 +2548,13 @@ void processProgramOptions(const variables_map& vm, std::map<std::string,std::st
         mConfig["SingleInstance"] = "1";
     }
 
+    if (vm.count("server")) {
+        mConfig["ServerAddress"] = vm["server"].as<string>();
+        mConfig["ServerWorkers"] = vm.count("workers") ? std::to_string(vm["workers"].as<int>()) : "1";
+        mConfig["RunMode"] = "Internal";
+        mConfig["ScriptFileName"] = "FreeCADServer";
+    }
+
     if (vm.count("dump-config")) {
         std::stringstream str;
         for (const auto & it : mConfig) {
@@ -2828,6 +2849,7 @@ void Application::initApplication()
     new Base::ScriptProducer( "CMakeVariables", CMakeVariables );
     new Base::ScriptProducer( "FreeCADInit",    FreeCADInit    );
     new Base::ScriptProducer( "FreeCADTest",    FreeCADTest    );
+    new Base::ScriptProducer( "FreeCADServer",  FreeCADServer  );
 
     // creating the application
     if (!(mConfig["Verbose"] == "Strict"))
@@ -423,14 +423,15 @@ protected:
         // clang-format off
         std::vector<Base::Vector3d> output;
         output.reserve(input.size());
-        Base::Matrix4D mat(getTransform());
         std::transform(input.cbegin(), input.cend(), std::back_inserter(output),
-                       [&mat](const Vec& vec) {
-                           return mat * Base::Vector3d(static_cast<double>(vec.x),
-                                                       static_cast<double>(vec.y),
-                                                       static_cast<double>(vec.z));
+                       [](const Vec& vec) {
+                           return Base::Vector3d(static_cast<double>(vec.x),
+                                                 static_cast<double>(vec.y),
+                                                 static_cast<double>(vec.z));
                        });
 
+        Base::Matrix4D mat(getTransform());
+        mat.multVec(output.data(), output.data(), output.size());
         return output;
         // clang-format on
     }
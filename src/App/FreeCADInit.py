@@ -176,9 +176,70 @@ def InitApplications():
     if os.path.isdir(additional_packages_path):
         sys.path.append(additional_packages_path)
 
+    # package.xml files are parsed once and the parts needed at startup are kept in the
+    # user cache directory, keyed by file path and invalidated by the file's mtime and size
+    MetadataCacheFile = os.path.join(FreeCAD.getUserCachePath(), "ModuleMetadataCache.json")
+    MetadataCacheVersion = ".".join(FreeCAD.Version()[0:4])
+    MetadataCache = {}
+    UsedMetadata = {}
+    try:
+        with open(MetadataCacheFile, 'rt', encoding='utf-8') as f:
+            cache = json.load(f)
+        # a damaged or foreign cache file is treated like an empty cache
+        if isinstance(cache, dict) and cache.get("version") == MetadataCacheVersion:
+            files = cache.get("files", {})
+            if isinstance(files, dict):
+                MetadataCache = files
+    except (OSError, ValueError):
+        pass
+
+    def readMetadata(MetadataFile):
+        stat = os.stat(MetadataFile)
+        stamp = [stat.st_mtime_ns, stat.st_size]
+        entry = MetadataCache.get(MetadataFile)
+        if not isinstance(entry, dict) or entry.get("stamp") != stamp:
+            meta = FreeCAD.Metadata(MetadataFile)
+            entry = {"stamp": stamp,
+                     "name": meta.Name,
+                     "supported": meta.supportsCurrentFreeCAD(),
+                     "workbenches": []}
+            for workbench in meta.Content.get("workbench", []):
+                entry["workbenches"].append({"name": workbench.Name,
+                                             "subdirectory": workbench.Subdirectory,
+                                             "supported": workbench.supportsCurrentFreeCAD()})
+        UsedMetadata[MetadataFile] = entry
+        return entry
+
+    def saveMetadataCache():
+        if UsedMetadata == MetadataCache:
+            return
+        # write to a temporary file first so that a crash or a concurrent instance
+        # never leaves a truncated cache behind
+        TempFile = None
+        try:
+            CacheDir = os.path.dirname(MetadataCacheFile)
+            os.makedirs(CacheDir, exist_ok=True)
+            fd, TempFile = tempfile.mkstemp(prefix="ModuleMetadataCache.", suffix=".tmp",
+                                            dir=CacheDir)
+            with os.fdopen(fd, 'wt', encoding='utf-8') as f:
+                json.dump({"version": MetadataCacheVersion, "files": UsedMetadata}, f)
+            os.replace(TempFile, MetadataCacheFile)
+            TempFile = None
+        except OSError as exc:
+            Log('Init: Failed to write ' + MetadataCacheFile + ': ' + str(exc) + '\n')
+        finally:
+            if TempFile:
+                try:
+                    os.remove(TempFile)
+                except OSError:
+                    pass
+
+    InitStart = time.perf_counter()
+
     def RunInitPy(Dir):
         InstallFile = os.path.join(Dir,"Init.py")
         if (os.path.exists(InstallFile)):
+            start = time.perf_counter()
             try:
                 with open(InstallFile, 'rt', encoding='utf-8') as f:
                     exec(compile(f.read(), InstallFile, 'exec'))
@@ -190,29 +251,25 @@ def InitApplications():
                 Err('During initialization the error "' + str(inst) + '" occurred in ' + InstallFile + '\n')
                 Err('Please look into the log file for further information\n')
             else:
-                Log('Init:      Initializing ' + Dir + '... done\n')
+                Log(f'Init:      Initializing {Dir}... done ({time.perf_counter() - start:.3f} s)\n')
         else:
             Log('Init:      Initializing ' + Dir + '(Init.py not found)... ignore\n')
 
     def processMetadataFile(MetadataFile):
-        meta = FreeCAD.Metadata(MetadataFile)
-        if not meta.supportsCurrentFreeCAD():
-            Msg(f'NOTICE: {meta.Name} does not support this version of FreeCAD, so is being skipped\n')
+        meta = readMetadata(MetadataFile)
+        if not meta["supported"]:
+            Msg(f'NOTICE: {meta["name"]} does not support this version of FreeCAD, so is being skipped\n')
             return None
-        content = meta.Content
-        if "workbench" in content:
-            workbenches = content["workbench"]
-            for workbench in workbenches:
-                if not workbench.supportsCurrentFreeCAD():
-                    Msg(f'NOTICE: {meta.Name} content item {workbench.Name} does not support this version of FreeCAD, so is being skipped\n')
-                    return None
-                subdirectory = workbench.Name if not workbench.Subdirectory else workbench.Subdirectory
-                subdirectory = subdirectory.replace("/",os.path.sep)
-                subdirectory = os.path.join(Dir, subdirectory)
-                #classname = workbench.Classname
-                sys.path.insert(0,subdirectory)
-                PathExtension.append(subdirectory)
-                RunInitPy(subdirectory)
+        for workbench in meta["workbenches"]:
+            if not workbench["supported"]:
+                Msg(f'NOTICE: {meta["name"]} content item {workbench["name"]} does not support this version of FreeCAD, so is being skipped\n')
+                return None
+            subdirectory = workbench["name"] if not workbench["subdirectory"] else workbench["subdirectory"]
+            subdirectory = subdirectory.replace("/",os.path.sep)
+            subdirectory = os.path.join(Dir, subdirectory)
+            sys.path.insert(0,subdirectory)
+            PathExtension.append(subdirectory)
+            RunInitPy(subdirectory)
 
     def tryProcessMetadataFile(MetadataFile):
         try:
@@ -272,16 +329,17 @@ def InitApplications():
                     # Make sure that package.xml (if present) does not exclude this version of FreeCAD
                     MetadataFile = os.path.join(FreeCAD.getUserAppDataDir(), "Mod", freecad_module_name[8:], "package.xml")
                     if os.path.exists(MetadataFile):
-                        meta = FreeCAD.Metadata(MetadataFile)
-                        if not meta.supportsCurrentFreeCAD():
+                        meta = readMetadata(MetadataFile)
+                        if not meta["supported"]:
                             Msg(f'NOTICE: Addon "{freecad_module_name}" does not support this version of FreeCAD, so is being skipped\n')
                             continue
 
+                    start = time.perf_counter()
                     freecad_module = importlib.import_module(freecad_module_name)
                     extension_modules += [freecad_module_name]
                     if any (module_name == 'init' for _, module_name, ispkg in pkgutil.iter_modules(freecad_module.__path__)):
                         importlib.import_module(freecad_module_name + '.init')
-                        Log('Init: Initializing ' + freecad_module_name + '... done\n')
+                        Log(f'Init: Initializing {freecad_module_name}... done ({time.perf_counter() - start:.3f} s)\n')
                     else:
                         Log('Init: No init module found in ' + freecad_module_name + ', skipping\n')
                 except Exception as inst:
@@ -296,6 +354,9 @@ def InitApplications():
     except ImportError as inst:
         Err('During initialization the error "' + str(inst) + '" occurred\n')
 
+    saveMetadataCache()
+    Log(f'Init: Initializing modules took {time.perf_counter() - InitStart:.3f} s\n')
+
     Log("Using "+ModDir+" as module path!\n")
     # In certain cases the PathExtension list can contain invalid strings. We concatenate them to a single string
     # but check that the output is a valid string
@@ -333,7 +394,7 @@ App.__unit_test__ = []
 Log ('Init: starting App::FreeCADInit.py\n')
 
 try:
-    import sys,os,traceback,inspect
+    import sys,os,traceback,inspect,json,tempfile,time
     from datetime import datetime
 except ImportError:
     FreeCAD.Console.PrintError("\n\nSeems the python standard libs are not installed, bailing out!\n\n")
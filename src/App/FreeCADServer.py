@@ -0,0 +1,188 @@
+# ***************************************************************************
+# *   Copyright (c) 2024 The FreeCAD Project Association                    *
+# *                                                                         *
+# *   This file is part of the FreeCAD CAx development system.              *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful,            *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Lesser General Public License for more details.                   *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with FreeCAD; if not, write to the Free Software        *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************/
+
+# FreeCAD server mode
+#
+# Keeps an initialized application resident and runs batch jobs sent to it.
+# Started with 'FreeCADCmd --server' (jobs are read from stdin) or with
+# 'FreeCADCmd --server /path/to/socket --workers N' (jobs are accepted on a
+# local Unix socket by N forked worker processes).
+#
+# The protocol is line based, each request and reply is a JSON object:
+#   request: {"id": 1, "script": "python code"} or {"id": 1, "file": "job.py"}
+#            optional "args": any JSON value, available to the job as 'args'
+#   reply:   {"id": 1, "ok": true, "result": ...} or
+#            {"id": 1, "ok": false, "error": "traceback"}
+# The job can set the global variable 'result' to return a JSON value.
+# Documents opened by a job are closed when it finishes.
+
+
+import gc
+import json
+import os
+import signal
+import socket
+import stat
+import sys
+import traceback
+
+import FreeCAD
+
+
+def runJob(request):
+    documents = set(FreeCAD.listDocuments())
+    reply = {"id": request.get("id")}
+    scope = {"__name__": "__main__", "args": request.get("args"), "result": None}
+    try:
+        if "file" in request:
+            fileName = request["file"]
+            with open(fileName, "rt", encoding="utf-8") as f:
+                source = f.read()
+        else:
+            fileName = "<job>"
+            source = request["script"]
+        exec(compile(source, fileName, "exec"), scope)
+        result = scope.get("result")
+        json.dumps(result)
+        reply["ok"] = True
+        reply["result"] = result
+    except BaseException:
+        # sys.exit() or an explicit KeyboardInterrupt in a job must not end the worker
+        reply["ok"] = False
+        reply["error"] = traceback.format_exc()
+    finally:
+        for name in set(FreeCAD.listDocuments()) - documents:
+            # the reply must be sent even if a document cannot be closed
+            try:
+                FreeCAD.closeDocument(name)
+            except Exception:
+                Wrn("Failed to close document {}:\n{}".format(name, traceback.format_exc()))
+        scope.clear()
+        gc.collect()
+    return reply
+
+
+def serve(reader, writer):
+    for line in reader:
+        line = line.strip()
+        if not line:
+            continue
+        try:
+            request = json.loads(line)
+        except ValueError as exc:
+            reply = {"id": None, "ok": False, "error": str(exc)}
+        else:
+            if request.get("command") == "quit":
+                return False
+            reply = runJob(request)
+        writer.write(json.dumps(reply) + "\n")
+        writer.flush()
+    return True
+
+
+def serveStdin():
+    # anything else printed to stdout (console observers, print() in jobs)
+    # must not end up in the reply stream
+    writer = os.fdopen(os.dup(sys.stdout.fileno()), "w", encoding="utf-8")
+    sys.stdout.flush()
+    os.dup2(sys.stderr.fileno(), sys.stdout.fileno())
+    serve(sys.stdin, writer)
+
+
+def serveSocket(server):
+    while True:
+        connection, _ = server.accept()
+        with connection:
+            reader = connection.makefile("r", encoding="utf-8")
+            writer = connection.makefile("w", encoding="utf-8")
+            if not serve(reader, writer):
+                return
+
+
+def startWorker(server):
+    pid = os.fork()
+    if pid == 0:
+        signal.signal(signal.SIGTERM, signal.SIG_DFL)
+        signal.signal(signal.SIGINT, signal.SIG_DFL)
+        try:
+            serveSocket(server)
+        except BaseException:
+            traceback.print_exc()
+            os._exit(1)
+        os._exit(0)
+    return pid
+
+
+def serveWorkers(address, count):
+    # only replace the socket of a previous server, never any other file
+    if os.path.lexists(address):
+        if not stat.S_ISSOCK(os.lstat(address).st_mode):
+            raise FileExistsError("Server address {} exists and is not a socket".format(address))
+        os.unlink(address)
+    server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    # jobs run arbitrary code, so only the owner may connect
+    umask = os.umask(0o177)
+    try:
+        server.bind(address)
+    finally:
+        os.umask(umask)
+    server.listen()
+    Log("Server listening on {} with {} worker(s)\n".format(address, count))
+
+    if count <= 1 or not hasattr(os, "fork"):
+        try:
+            serveSocket(server)
+        finally:
+            server.close()
+            os.unlink(address)
+        return
+
+    # the workers inherit the initialized application and the listening socket
+    workers = set(startWorker(server) for _ in range(count))
+
+    def stop(signum, frame):
+        for pid in workers:
+            os.kill(pid, signal.SIGTERM)
+        raise SystemExit(0)
+
+    signal.signal(signal.SIGTERM, stop)
+    signal.signal(signal.SIGINT, stop)
+    try:
+        while workers:
+            pid, status = os.wait()
+            workers.discard(pid)
+            # a worker received a quit request: shut down the others
+            if os.waitstatus_to_exitcode(status) == 0:
+                stop(signal.SIGTERM, None)
+            Wrn("Server worker {} died, starting a new one\n".format(pid))
+            workers.add(startWorker(server))
+    finally:
+        server.close()
+        os.unlink(address)
+
+
+address = FreeCAD.ConfigGet("ServerAddress")
+if address in ("", "-"):
+    serveStdin()
+else:
+    serveWorkers(address, int(FreeCAD.ConfigGet("ServerWorkers") or "1"))
@@ -29,13 +29,17 @@
 #elif defined(FC_OS_LINUX) || defined(FC_OS_MACOSX)
 #include <unistd.h>
 #endif
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <functional>
+#include <map>
 #endif
 
 #include "Console.h"
 #include "PyObjectBase.h"
 #include <QCoreApplication>
+#include <QTimerEvent>
 
 
 using namespace Base;
@@ -46,32 +50,89 @@ using namespace Base;
 namespace Base
 {
 
-class ConsoleEvent: public QEvent
+/// A preformatted message waiting in the queue of ConsoleOutput
+class ConsoleRecord
 {
 public:
-    ConsoleSingleton::FreeCAD_ConsoleMsgType msgtype;
-    IntendedRecipient recipient;
-    ContentType content;
+    std::atomic<ConsoleRecord*> next {nullptr};
+    ConsoleSingleton::FreeCAD_ConsoleMsgType msgtype {ConsoleSingleton::MsgType_Txt};
+    IntendedRecipient recipient {IntendedRecipient::All};
+    ContentType content {ContentType::Untranslated};
     std::string notifier;
     std::string msg;
+};
 
-    ConsoleEvent(ConsoleSingleton::FreeCAD_ConsoleMsgType type,
-                 IntendedRecipient recipient,
-                 ContentType content,
-                 const std::string& notifier,
-                 const std::string& msg)
-        : QEvent(QEvent::User)
-        , msgtype(type)
-        , recipient(recipient)
-        , content(content)
-        , notifier(notifier)
-        , msg(msg)
+/** Intrusive multi-producer/single-consumer queue of console records.
+ *  Producers only do an atomic exchange, the single consumer (the main thread)
+ *  walks the list. A record that is being pushed while the consumer reaches the
+ *  end of the list is picked up in the next batch.
+ */
+class ConsoleQueue
+{
+public:
+    ConsoleQueue()
+        : head(&stub)
+        , tail(&stub)
     {}
+
+    void push(ConsoleRecord* rec)
+    {
+        rec->next.store(nullptr, std::memory_order_relaxed);
+        ConsoleRecord* prev = head.exchange(rec, std::memory_order_acq_rel);
+        prev->next.store(rec, std::memory_order_release);
+    }
+
+    ConsoleRecord* pop()
+    {
+        ConsoleRecord* first = tail;
+        ConsoleRecord* next = first->next.load(std::memory_order_acquire);
+        if (first == &stub) {
+            if (!next) {
+                return nullptr;
+            }
+            tail = next;
+            first = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next) {
+            tail = next;
+            return first;
+        }
+        if (first != head.load(std::memory_order_acquire)) {
+            // a producer is in the middle of a push
+            return nullptr;
+        }
+        push(&stub);
+        next = first->next.load(std::memory_order_acquire);
+        if (next) {
+            tail = next;
+            return first;
+        }
+        return nullptr;
+    }
+
+private:
+    ConsoleRecord stub;
+    std::atomic<ConsoleRecord*> head;
+    ConsoleRecord* tail;
 };
 
+/** Delivers the messages sent in queued mode.
+ *  Sending threads format the message, push it to a lock-free queue and only post a
+ *  wake-up event when the queue was empty. The main thread then delivers the whole
+ *  batch to the observers. The queue is bounded: non-error messages beyond
+ *  \a maxPending are dropped and reported as a single warning, and log messages
+ *  are rate limited per notifier. The number of suppressed log messages is reported
+ *  once the window of the notifier has expired, either when the queue drains or
+ *  from a timer if no further messages arrive.
+ */
 class ConsoleOutput: public QObject  // clazy:exclude=missing-qobject-macro
 {
 public:
+    static constexpr int maxPending = 10000;
+    static constexpr int maxLogsPerSecond = 500;
+    static constexpr std::chrono::seconds rateWindow {1};
+
     static ConsoleOutput* getInstance()
     {
         if (!instance) {
@@ -85,58 +146,183 @@ public:
         instance = nullptr;
     }
 
+    ~ConsoleOutput() override
+    {
+        while (ConsoleRecord* rec = queue.pop()) {
+            delete rec;
+        }
+    }
+
+    void post(ConsoleSingleton::FreeCAD_ConsoleMsgType type,
+              IntendedRecipient recipient,
+              ContentType content,
+              const std::string& notifier,
+              const std::string& msg)
+    {
+        bool mustDeliver =
+            type == ConsoleSingleton::MsgType_Err || type == ConsoleSingleton::MsgType_Critical;
+        if (pending.fetch_add(1, std::memory_order_acq_rel) >= maxPending && !mustDeliver) {
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto rec = new ConsoleRecord;
+        rec->msgtype = type;
+        rec->recipient = recipient;
+        rec->content = content;
+        rec->notifier = notifier;
+        rec->msg = msg;
+        queue.push(rec);
+
+        if (!wakeupPosted.exchange(true, std::memory_order_acq_rel)) {
+            QCoreApplication::postEvent(this, new QEvent(QEvent::User));
+        }
+    }
+
     void customEvent(QEvent* ev) override
     {
         if (ev->type() == QEvent::User) {
-            ConsoleEvent* ce = static_cast<ConsoleEvent*>(ev);
-            switch (ce->msgtype) {
-                case ConsoleSingleton::MsgType_Txt:
-                    Console().notifyPrivate(LogStyle::Message,
-                                            ce->recipient,
-                                            ce->content,
-                                            ce->notifier,
-                                            ce->msg);
-                    break;
-                case ConsoleSingleton::MsgType_Log:
-                    Console().notifyPrivate(LogStyle::Log,
-                                            ce->recipient,
-                                            ce->content,
-                                            ce->notifier,
-                                            ce->msg);
-                    break;
-                case ConsoleSingleton::MsgType_Wrn:
-                    Console().notifyPrivate(LogStyle::Warning,
-                                            ce->recipient,
-                                            ce->content,
-                                            ce->notifier,
-                                            ce->msg);
-                    break;
-                case ConsoleSingleton::MsgType_Err:
-                    Console().notifyPrivate(LogStyle::Error,
-                                            ce->recipient,
-                                            ce->content,
-                                            ce->notifier,
-                                            ce->msg);
-                    break;
-                case ConsoleSingleton::MsgType_Critical:
-                    Console().notifyPrivate(LogStyle::Critical,
-                                            ce->recipient,
-                                            ce->content,
-                                            ce->notifier,
-                                            ce->msg);
-                    break;
-                case ConsoleSingleton::MsgType_Notification:
-                    Console().notifyPrivate(LogStyle::Notification,
-                                            ce->recipient,
-                                            ce->content,
-                                            ce->notifier,
-                                            ce->msg);
-                    break;
-            }
+            wakeupPosted.store(false, std::memory_order_release);
+            deliverPending();
+        }
+    }
+
+    void timerEvent(QTimerEvent* ev) override
+    {
+        if (ev->timerId() != flushTimer) {
+            QObject::timerEvent(ev);
+            return;
+        }
+        flushRateLimits(std::chrono::steady_clock::now());
+        if (rateLimits.empty()) {
+            killTimer(flushTimer);
+            flushTimer = 0;
         }
     }
 
 private:
+    void deliverPending()
+    {
+        while (ConsoleRecord* rec = queue.pop()) {
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+            if (rec->msgtype != ConsoleSingleton::MsgType_Log || acceptLog(rec->notifier)) {
+                deliver(rec->msgtype, rec->recipient, rec->content, rec->notifier, rec->msg);
+            }
+            delete rec;
+        }
+
+        int lost = dropped.exchange(0, std::memory_order_relaxed);
+        if (lost > 0) {
+            deliver(ConsoleSingleton::MsgType_Wrn,
+                    IntendedRecipient::Developer,
+                    ContentType::Untranslated,
+                    std::string(),
+                    fmt::sprintf("Console queue full, %d messages dropped\n", lost));
+        }
+
+        flushRateLimits(std::chrono::steady_clock::now());
+
+        // a record whose push was still in progress is left for the next batch
+        if (pending.load(std::memory_order_acquire) > 0
+            && !wakeupPosted.exchange(true, std::memory_order_acq_rel)) {
+            QCoreApplication::postEvent(this, new QEvent(QEvent::User));
+        }
+    }
+
+    struct RateLimit
+    {
+        std::chrono::steady_clock::time_point start;
+        int count {0};
+        int suppressed {0};
+    };
+
+    bool acceptLog(const std::string& notifier)
+    {
+        auto now = std::chrono::steady_clock::now();
+        auto it = rateLimits.find(notifier);
+        if (it != rateLimits.end() && now - it->second.start >= rateWindow) {
+            reportSuppressed(it->first, it->second);
+            rateLimits.erase(it);
+            it = rateLimits.end();
+        }
+        if (it == rateLimits.end()) {
+            it = rateLimits.emplace(notifier, RateLimit {now}).first;
+        }
+
+        RateLimit& limit = it->second;
+        if (limit.count < maxLogsPerSecond) {
+            ++limit.count;
+            return true;
+        }
+        ++limit.suppressed;
+        if (flushTimer == 0) {
+            flushTimer = startTimer(rateWindow);
+        }
+        return false;
+    }
+
+    /// Reports the suppressed messages of expired windows and forgets their notifiers
+    void flushRateLimits(std::chrono::steady_clock::time_point now)
+    {
+        for (auto it = rateLimits.begin(); it != rateLimits.end();) {
+            if (now - it->second.start >= rateWindow) {
+                reportSuppressed(it->first, it->second);
+                it = rateLimits.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    static void reportSuppressed(const std::string& notifier, const RateLimit& limit)
+    {
+        if (limit.suppressed > 0) {
+            deliver(ConsoleSingleton::MsgType_Log,
+                    IntendedRecipient::Developer,
+                    ContentType::Untranslated,
+                    notifier,
+                    fmt::sprintf("%d log messages suppressed\n", limit.suppressed));
+        }
+    }
+
+    static void deliver(ConsoleSingleton::FreeCAD_ConsoleMsgType type,
+                        IntendedRecipient recipient,
+                        ContentType content,
+                        const std::string& notifier,
+                        const std::string& msg)
+    {
+        switch (type) {
+            case ConsoleSingleton::MsgType_Txt:
+                Console().notifyPrivate(LogStyle::Message, recipient, content, notifier, msg);
+                break;
+            case ConsoleSingleton::MsgType_Log:
+                Console().notifyPrivate(LogStyle::Log, recipient, content, notifier, msg);
+                break;
+            case ConsoleSingleton::MsgType_Wrn:
+                Console().notifyPrivate(LogStyle::Warning, recipient, content, notifier, msg);
+                break;
+            case ConsoleSingleton::MsgType_Err:
+                Console().notifyPrivate(LogStyle::Error, recipient, content, notifier, msg);
+                break;
+            case ConsoleSingleton::MsgType_Critical:
+                Console().notifyPrivate(LogStyle::Critical, recipient, content, notifier, msg);
+                break;
+            case ConsoleSingleton::MsgType_Notification:
+                Console().notifyPrivate(LogStyle::Notification, recipient, content, notifier, msg);
+                break;
+        }
+    }
+
+    ConsoleQueue queue;
+    std::atomic<int> pending {0};
+    std::atomic<int> dropped {0};
+    std::atomic<bool> wakeupPosted {false};
+    // only accessed by the consumer
+    std::map<std::string, RateLimit> rateLimits;
+    int flushTimer {0};
+
     static ConsoleOutput* instance;  // NOLINT
 };
 
@@ -340,8 +526,7 @@ void ConsoleSingleton::postEvent(ConsoleSingleton::FreeCAD_ConsoleMsgType type,
                                  const std::string& notifiername,
                                  const std::string& msg)
 {
-    QCoreApplication::postEvent(ConsoleOutput::getInstance(),
-                                new ConsoleEvent(type, recipient, content, notifiername, msg));
+    ConsoleOutput::getInstance()->post(type, recipient, content, notifiername, msg);
 }
 
 ILogger* ConsoleSingleton::Get(const char* Name) const
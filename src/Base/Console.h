@@ -792,6 +792,9 @@ public:
     {
         Verbose = 1,  // suppress Log messages
     };
+    /** Direct delivers messages in the sending thread, Queued pushes them to a
+     *  bounded lock-free queue that is drained in batches by the main thread.
+     */
     enum ConnectionMode
     {
         Direct = 0,
@@ -23,8 +23,12 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <QtConcurrentMap>
+#include <algorithm>
 #include <cstring>
 #include <sstream>
+#include <utility>
+#include <vector>
 #endif
 
 #include "Matrix.h"
@@ -501,6 +505,135 @@ bool Matrix4D::toAxisAngle(Vector3d& rclBase,
     return true;
 }
 
+namespace
+{
+
+/// Calls \a func for consecutive blocks of [0, count), in parallel if the range is large
+template<typename Func>
+void forEachBlock(std::size_t count, Func func)
+{
+    const std::size_t blockSize = 65536;
+    if (count < 2 * blockSize) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> blocks;
+    for (std::size_t begin = 0; begin < count; begin += blockSize) {
+        blocks.emplace_back(begin, std::min(count, begin + blockSize));
+    }
+    QtConcurrent::blockingMap(blocks, [&func](const std::pair<std::size_t, std::size_t>& block) {
+        func(block.first, block.second);
+    });
+}
+
+// The coefficients are copied to locals so that the compiler knows they cannot
+// alias the points and can keep them in registers or vectorize the loop.
+struct AffineCoefficients
+{
+    explicit AffineCoefficients(const double (&mat)[4][4])
+        : m00(mat[0][0]), m01(mat[0][1]), m02(mat[0][2]), m03(mat[0][3])
+        , m10(mat[1][0]), m11(mat[1][1]), m12(mat[1][2]), m13(mat[1][3])
+        , m20(mat[2][0]), m21(mat[2][1]), m22(mat[2][2]), m23(mat[2][3])
+    {}
+
+    template<typename T>
+    void transform(const Vector3<T>* src, Vector3<T>* dst, std::size_t begin, std::size_t end) const
+    {
+        for (std::size_t i = begin; i < end; i++) {
+            double sx = static_cast<double>(src[i].x);
+            double sy = static_cast<double>(src[i].y);
+            double sz = static_cast<double>(src[i].z);
+            dst[i].x = static_cast<T>(m00 * sx + m01 * sy + m02 * sz + m03);
+            dst[i].y = static_cast<T>(m10 * sx + m11 * sy + m12 * sz + m13);
+            dst[i].z = static_cast<T>(m20 * sx + m21 * sy + m22 * sz + m23);
+        }
+    }
+
+    template<typename T>
+    void transform(T* x, T* y, T* z, std::size_t begin, std::size_t end) const
+    {
+        for (std::size_t i = begin; i < end; i++) {
+            double sx = static_cast<double>(x[i]);
+            double sy = static_cast<double>(y[i]);
+            double sz = static_cast<double>(z[i]);
+            x[i] = static_cast<T>(m00 * sx + m01 * sy + m02 * sz + m03);
+            y[i] = static_cast<T>(m10 * sx + m11 * sy + m12 * sz + m13);
+            z[i] = static_cast<T>(m20 * sx + m21 * sy + m22 * sz + m23);
+        }
+    }
+
+    template<typename T>
+    void transform(char* points, std::size_t stride, std::size_t begin, std::size_t end) const
+    {
+        for (std::size_t i = begin; i < end; i++) {
+            auto pnt = reinterpret_cast<Vector3<T>*>(points + i * stride);  // NOLINT
+            double sx = static_cast<double>(pnt->x);
+            double sy = static_cast<double>(pnt->y);
+            double sz = static_cast<double>(pnt->z);
+            pnt->x = static_cast<T>(m00 * sx + m01 * sy + m02 * sz + m03);
+            pnt->y = static_cast<T>(m10 * sx + m11 * sy + m12 * sz + m13);
+            pnt->z = static_cast<T>(m20 * sx + m21 * sy + m22 * sz + m23);
+        }
+    }
+
+    double m00, m01, m02, m03;
+    double m10, m11, m12, m13;
+    double m20, m21, m22, m23;
+};
+
+}  // namespace
+
+void Matrix4D::multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const
+{
+    AffineCoefficients coeff(dMtrx4D);
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        coeff.transform(src, dst, begin, end);
+    });
+}
+
+void Matrix4D::multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const
+{
+    AffineCoefficients coeff(dMtrx4D);
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        coeff.transform(src, dst, begin, end);
+    });
+}
+
+void Matrix4D::multVec(double* x, double* y, double* z, std::size_t count) const
+{
+    AffineCoefficients coeff(dMtrx4D);
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        coeff.transform(x, y, z, begin, end);
+    });
+}
+
+void Matrix4D::multVec(float* x, float* y, float* z, std::size_t count) const
+{
+    AffineCoefficients coeff(dMtrx4D);
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        coeff.transform(x, y, z, begin, end);
+    });
+}
+
+void Matrix4D::multVec(Vector3d* points, std::size_t count, std::size_t stride) const
+{
+    AffineCoefficients coeff(dMtrx4D);
+    auto data = reinterpret_cast<char*>(points);  // NOLINT
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        coeff.transform<double>(data, stride, begin, end);
+    });
+}
+
+void Matrix4D::multVec(Vector3f* points, std::size_t count, std::size_t stride) const
+{
+    AffineCoefficients coeff(dMtrx4D);
+    auto data = reinterpret_cast<char*>(points);  // NOLINT
+    forEachBlock(count, [&](std::size_t begin, std::size_t end) {
+        coeff.transform<float>(data, stride, begin, end);
+    });
+}
+
 void Matrix4D::transform(const Vector3f& vec, const Matrix4D& mat)
 {
     move(-vec);
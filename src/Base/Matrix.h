@@ -26,6 +26,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <string>
 
 #include "Vector3D.h"
@@ -99,6 +100,21 @@ public:
     inline Vector3d operator*(const Vector3d& vec) const;
     inline void multVec(const Vector3d& src, Vector3d& dst) const;
     inline void multVec(const Vector3f& src, Vector3f& dst) const;
+    /** @name Batch transformation
+     * Transform \a count points at once. \a src and \a dst may be the same array.
+     * Large arrays are split among several threads.
+     */
+    //@{
+    void multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const;
+    void multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const;
+    /// Transforms points given as separate coordinate arrays in place
+    void multVec(double* x, double* y, double* z, std::size_t count) const;
+    void multVec(float* x, float* y, float* z, std::size_t count) const;
+    /// Transforms \a count points in place whose addresses are \a stride bytes apart,
+    /// e.g. the vector base of an array of structures
+    void multVec(Vector3d* points, std::size_t count, std::size_t stride) const;
+    void multVec(Vector3f* points, std::size_t count, std::size_t stride) const;
+    //@}
     inline Matrix4D operator*(double scalar) const;
     inline Matrix4D& operator*=(double scalar);
     /// Comparison
@@ -703,19 +703,69 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
         return;
     }
 
-    // find or create the Element
-    DOMElement* pcElem = FindOrCreateElement(_pGroupNode, Type, Name);
-    if (pcElem) {
+    if (_Detached && _Parent) {
+        // re-attach the group before the cache is locked, this notifies observers
+        _Parent->_GetGroup(_cName.c_str());
+    }
+
+    bool changed = false;
+    {
+        // Change the DOM and clear the cache under the same lock, otherwise a
+        // concurrent reader could cache the old value again.
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        // find or create the Element
+        DOMElement* pcElem = FindOrCreateElement(_pGroupNode, Type, Name);
+        if (!pcElem) {
+            return;
+        }
         XStr attr("Value");
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
             pcElem->setAttribute(attr.unicodeForm(), XStr(Value).unicodeForm());
-            // trigger observer
-            _Notify(T, Name, Value);
+            changed = true;
         }
-        // For backward compatibility, old observer gets notified regardless of
-        // value changes or not.
-        Notify(Name);
+        _ClearCache();
+    }
+
+    // trigger observer
+    if (changed) {
+        _Notify(T, Name, Value);
+    }
+    // For backward compatibility, old observer gets notified regardless of
+    // value changes or not.
+    Notify(Name);
+}
+
+const ParameterGrp::CachedValue& ParameterGrp::_GetCachedValue(ParamType Type,
+                                                                const char* Name) const
+{
+    ValueCache& cache = _Cache[static_cast<int>(Type) - static_cast<int>(ParamType::FCText)];
+    auto it = cache.find(std::string_view(Name));
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    CachedValue entry;
+    DOMElement* pcElem = FindElement(_pGroupNode, TypeName(Type), Name);
+    if (pcElem) {
+        entry.found = true;
+        if (Type == ParamType::FCText) {
+            DOMNode* pcElem2 = pcElem->getFirstChild();
+            if (pcElem2) {
+                entry.value = StrXUTF8(pcElem2->getNodeValue()).c_str();
+            }
+        }
+        else {
+            entry.value = StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str();
+        }
+    }
+    return cache.emplace(Name, std::move(entry)).first->second;
+}
+
+void ParameterGrp::_ClearCache()
+{
+    for (auto& cache : _Cache) {
+        cache.clear();
     }
 }
 
@@ -725,16 +775,15 @@ bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
         return bPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return preset
-    if (!pcElem) {
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    const CachedValue& entry = _GetCachedValue(ParamType::FCBool, Name);
+    // if not in group return preset
+    if (!entry.found) {
         return bPreset;
     }
 
     // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), "1")
-            == 0);
+    return entry.value == "1";
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -804,14 +853,14 @@ long ParameterGrp::GetInt(const char* Name, long lPreset) const
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    const CachedValue& entry = _GetCachedValue(ParamType::FCInt, Name);
+    // if not in group return preset
+    if (!entry.found) {
         return lPreset;
     }
     // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return atol(entry.value.c_str());
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -873,18 +922,16 @@ unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset)
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    const CachedValue& entry = _GetCachedValue(ParamType::FCUInt, Name);
+    // if not in group return preset
+    if (!entry.found) {
         return lPreset;
     }
 
     // if yes check the value and return
     const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(),
-                   nullptr,
-                   base);
+    return strtoul(entry.value.c_str(), nullptr, base);
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -953,14 +1000,14 @@ double ParameterGrp::GetFloat(const char* Name, double dPreset) const
         return dPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    const CachedValue& entry = _GetCachedValue(ParamType::FCFloat, Name);
+    // if not in group return preset
+    if (!entry.found) {
         return dPreset;
     }
     // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return atof(entry.value.c_str());
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1033,30 +1080,44 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
         return;
     }
 
-    bool isNew = false;
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    if (!pcElem) {
-        pcElem = CreateElement(_pGroupNode, "FCText", Name);
-        isNew = true;
+    if (_Detached && _Parent) {
+        // re-attach the group before the cache is locked, this notifies observers
+        _Parent->_GetGroup(_cName.c_str());
     }
-    if (pcElem) {
+
+    bool changed = false;
+    {
+        // see _SetAttribute()
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        bool isNew = false;
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
+        if (!pcElem) {
+            pcElem = CreateElement(_pGroupNode, "FCText", Name);
+            isNew = true;
+        }
+        if (!pcElem) {
+            return;
+        }
         // and set the value
         DOMNode* pcElem2 = pcElem->getFirstChild();
         if (!pcElem2) {
             XERCES_CPP_NAMESPACE_QUALIFIER DOMDocument* pDocument = _pGroupNode->getOwnerDocument();
             DOMText* pText = pDocument->createTextNode(XUTF8Str(sValue).unicodeForm());
             pcElem->appendChild(pText);
-            if (isNew || sValue[0] != 0) {
-                _Notify(ParamType::FCText, Name, sValue);
-            }
+            changed = isNew || sValue[0] != 0;
         }
         else if (strcmp(StrXUTF8(pcElem2->getNodeValue()).c_str(), sValue) != 0) {
             pcElem2->setNodeValue(XUTF8Str(sValue).unicodeForm());
-            _Notify(ParamType::FCText, Name, sValue);
+            changed = true;
         }
-        // trigger observer
-        Notify(Name);
+        _ClearCache();
+    }
+
+    if (changed) {
+        _Notify(ParamType::FCText, Name, sValue);
     }
+    // trigger observer
+    Notify(Name);
 }
 
 std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
@@ -1065,21 +1126,17 @@ std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
         return pPreset ? pPreset : "";
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    const CachedValue& entry = _GetCachedValue(ParamType::FCText, Name);
+    // if not in group return preset
+    if (!entry.found) {
         if (!pPreset) {
             return {};
         }
         return {pPreset};
     }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
-    }
-    return {};
+    // if yes return the value
+    return entry.value;
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1152,15 +1209,19 @@ void ParameterGrp::RemoveASCII(const char* Name)
         return;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return
-    if (!pcElem) {
-        return;
-    }
+    {
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
+        // if not return
+        if (!pcElem) {
+            return;
+        }
 
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
+        DOMNode* node = _pGroupNode->removeChild(pcElem);
+        node->release();
+        _ClearCache();
+    }
 
     // trigger observer
     _Notify(ParamType::FCText, Name, nullptr);
@@ -1173,15 +1234,19 @@ void ParameterGrp::RemoveBool(const char* Name)
         return;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return
-    if (!pcElem) {
-        return;
-    }
+    {
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
+        // if not return
+        if (!pcElem) {
+            return;
+        }
 
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
+        DOMNode* node = _pGroupNode->removeChild(pcElem);
+        node->release();
+        _ClearCache();
+    }
 
     // trigger observer
     _Notify(ParamType::FCBool, Name, nullptr);
@@ -1195,15 +1260,19 @@ void ParameterGrp::RemoveFloat(const char* Name)
         return;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return
-    if (!pcElem) {
-        return;
-    }
+    {
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
+        // if not return
+        if (!pcElem) {
+            return;
+        }
 
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
+        DOMNode* node = _pGroupNode->removeChild(pcElem);
+        node->release();
+        _ClearCache();
+    }
 
     // trigger observer
     _Notify(ParamType::FCFloat, Name, nullptr);
@@ -1216,15 +1285,19 @@ void ParameterGrp::RemoveInt(const char* Name)
         return;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return
-    if (!pcElem) {
-        return;
-    }
+    {
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
+        // if not return
+        if (!pcElem) {
+            return;
+        }
 
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
+        DOMNode* node = _pGroupNode->removeChild(pcElem);
+        node->release();
+        _ClearCache();
+    }
 
     // trigger observer
     _Notify(ParamType::FCInt, Name, nullptr);
@@ -1237,15 +1310,19 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
         return;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return
-    if (!pcElem) {
-        return;
-    }
+    {
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
+        // if not return
+        if (!pcElem) {
+            return;
+        }
 
-    DOMNode* node = _pGroupNode->removeChild(pcElem);
-    node->release();
+        DOMNode* node = _pGroupNode->removeChild(pcElem);
+        node->release();
+        _ClearCache();
+    }
 
     // trigger observer
     _Notify(ParamType::FCUInt, Name, nullptr);
@@ -1349,19 +1426,23 @@ void ParameterGrp::Clear(bool notify)
 
     // Remove the rest of non-group nodes;
     std::vector<std::pair<ParamType, std::string>> params;
-    for (DOMNode *child = _pGroupNode->getFirstChild(), *next = child; child != nullptr;
-         child = next) {
-        next = next->getNextSibling();
-        ParamType type = TypeValue(StrX(child->getNodeName()).c_str());
-        if (type != ParamType::FCInvalid && type != ParamType::FCGroup) {
-            params.emplace_back(type,
-                                StrX(child->getAttributes()
-                                         ->getNamedItem(XStrLiteral("Name").unicodeForm())
-                                         ->getNodeValue())
-                                    .c_str());
-        }
-        DOMNode* node = _pGroupNode->removeChild(child);
-        node->release();
+    {
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        for (DOMNode *child = _pGroupNode->getFirstChild(), *next = child; child != nullptr;
+             child = next) {
+            next = next->getNextSibling();
+            ParamType type = TypeValue(StrX(child->getNodeName()).c_str());
+            if (type != ParamType::FCInvalid && type != ParamType::FCGroup) {
+                params.emplace_back(type,
+                                    StrX(child->getAttributes()
+                                             ->getNamedItem(XStrLiteral("Name").unicodeForm())
+                                             ->getNodeValue())
+                                        .c_str());
+            }
+            DOMNode* node = _pGroupNode->removeChild(child);
+            node->release();
+        }
+        _ClearCache();
     }
 
     for (auto& v : params) {
@@ -1540,7 +1621,11 @@ void ParameterGrp::NotifyAll()
 
 void ParameterGrp::_Reset()
 {
-    _pGroupNode = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        _pGroupNode = nullptr;
+        _ClearCache();
+    }
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1869,7 +1954,11 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
         throw XMLBaseException("Malformed Parameter document: Root group not found");
     }
 
-    _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    {
+        std::lock_guard<std::mutex> lock(_CacheMutex);
+        _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+        _ClearCache();
+    }
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1985,6 +2074,7 @@ void ParameterManager::CreateDocument()
     // creating a document from screatch
     DOMImplementation* impl =
         DOMImplementationRegistry::getDOMImplementation(XStrLiteral("Core").unicodeForm());
+    std::lock_guard<std::mutex> lock(_CacheMutex);
     delete _pDocument;
     _pDocument =
         impl->createDocument(nullptr,  // root element namespace URI.
@@ -1996,6 +2086,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStrLiteral("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStrLiteral("Name").unicodeForm(), XStrLiteral("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _ClearCache();
 }
 
 void ParameterManager::CheckDocument() const
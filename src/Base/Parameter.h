@@ -46,6 +46,10 @@ using PyObject = struct _object;
 #endif
 
 #include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <boost/signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -431,6 +435,36 @@ protected:
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
 
+    /// Value of a parameter as stored in the DOM
+    struct CachedValue
+    {
+        bool found = false;
+        std::string value;
+    };
+
+    /// Hash that allows to look up the cache with a plain string
+    struct CacheHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view str) const
+        {
+            return std::hash<std::string_view> {}(str);
+        }
+    };
+
+    using ValueCache = std::unordered_map<std::string, CachedValue, CacheHash, std::equal_to<>>;
+
+    /** Look up the parameter \a Name of \a Type in the cache of this group.
+     *  On a cache miss the value is read from the DOM and cached. The caller
+     *  must hold _CacheMutex.
+     */
+    const CachedValue& _GetCachedValue(ParamType Type, const char* Name) const;
+    /** Drop all cached values, must be called whenever the DOM of this group
+     *  changes. The caller must hold _CacheMutex while changing the DOM and
+     *  clearing the cache.
+     */
+    void _ClearCache();
+
     XERCES_CPP_NAMESPACE_QUALIFIER DOMElement*
     FindNextElement(XERCES_CPP_NAMESPACE_QUALIFIER DOMNode* Prev, const char* Type) const;
 
@@ -480,6 +514,9 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+    /// Cached parameter values of this group, one map per type from FCText to FCFloat
+    mutable ValueCache _Cache[5];
+    mutable std::mutex _CacheMutex;
 };
 
 /** The parameter serializer class
@@ -23,6 +23,7 @@
 #ifndef BASE_PLACEMENT_H
 #define BASE_PLACEMENT_H
 
+#include <cstddef>
 #include <string>
 
 #include "Rotation.h"
@@ -104,6 +105,9 @@ public:
 
     void multVec(const Vector3d& src, Vector3d& dst) const;
     void multVec(const Vector3f& src, Vector3f& dst) const;
+    /// Transforms \a count points at once, see Matrix4D::multVec()
+    void multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const;
+    void multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const;
     //@}
 
     static Placement slerp(const Placement& p0, const Placement& p1, double t);
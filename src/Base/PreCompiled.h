@@ -76,6 +76,7 @@
 #include <queue>
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include <bitset>
 #include <algorithm>
 
@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association                    *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <cstring>
+#include <limits>
+#include <string>
+#endif
+
+#include "PyBuffer.h"
+
+
+namespace
+{
+
+class BufferView
+{
+public:
+    explicit BufferView(PyObject* obj)
+    {
+        if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+            throw Py::Exception();
+        }
+    }
+    ~BufferView()
+    {
+        PyBuffer_Release(&view);
+    }
+    BufferView(const BufferView&) = delete;
+    BufferView& operator=(const BufferView&) = delete;
+
+    char format() const
+    {
+        const char* fmt = view.format ? view.format : "B";
+        // only native byte order and size is supported
+        if (*fmt == '@') {
+            ++fmt;
+        }
+        if (std::strlen(fmt) != 1) {
+            return 0;
+        }
+        return *fmt;
+    }
+
+    Py_buffer view {};
+};
+
+template<typename Item, typename T>
+void convertItems(const Py_buffer& view, std::vector<T>& values)
+{
+    std::size_t count = view.len / sizeof(Item);
+    values.resize(count);
+    const char* data = static_cast<const char*>(view.buf);
+    for (std::size_t i = 0; i < count; i++) {
+        Item item;
+        std::memcpy(&item, data + i * sizeof(Item), sizeof(Item));
+        values[i] = static_cast<T>(item);
+    }
+}
+
+template<typename T>
+bool convertIntegers(char format, const Py_buffer& view, std::vector<T>& values)
+{
+    switch (format) {
+        case 'b':
+            convertItems<signed char>(view, values);
+            return true;
+        case 'B':
+            convertItems<unsigned char>(view, values);
+            return true;
+        case 'h':
+            convertItems<short>(view, values);
+            return true;
+        case 'H':
+            convertItems<unsigned short>(view, values);
+            return true;
+        case 'i':
+            convertItems<int>(view, values);
+            return true;
+        case 'I':
+            convertItems<unsigned int>(view, values);
+            return true;
+        case 'l':
+            convertItems<long>(view, values);
+            return true;
+        case 'L':
+            convertItems<unsigned long>(view, values);
+            return true;
+        case 'q':
+            convertItems<long long>(view, values);
+            return true;
+        case 'Q':
+            convertItems<unsigned long long>(view, values);
+            return true;
+        case 'n':
+            convertItems<Py_ssize_t>(view, values);
+            return true;
+        case 'N':
+            convertItems<std::size_t>(view, values);
+            return true;
+        default:
+            return false;
+    }
+}
+
+void checkColumns(std::size_t count, Py_ssize_t columns)
+{
+    if (count % columns != 0) {
+        std::string error = "number of items must be a multiple of " + std::to_string(columns);
+        throw Py::ValueError(error);
+    }
+}
+
+// Python refuses to cast to a shape containing zeros, so the view of an empty
+// buffer is described directly. The memoryview copies shape and strides but keeps
+// the format pointer, hence the static strings.
+Py::Object createEmptyView(char format, Py_ssize_t itemSize, Py_ssize_t columns, void*& data)
+{
+    static char storage {};
+    const char* fmt {};
+    switch (format) {
+        case 'f':
+            fmt = "f";
+            break;
+        case 'd':
+            fmt = "d";
+            break;
+        case 'I':
+            fmt = "I";
+            break;
+        default:
+            throw Py::TypeError("unsupported buffer format");
+    }
+
+    Py_ssize_t shape[2] = {0, columns};
+    Py_ssize_t strides[2] = {columns * itemSize, itemSize};
+    Py_buffer info {};
+    info.buf = &storage;
+    info.len = 0;
+    info.itemsize = itemSize;
+    info.readonly = 0;
+    info.ndim = 2;
+    info.format = const_cast<char*>(fmt);  // NOLINT
+    info.shape = shape;
+    info.strides = strides;
+
+    data = info.buf;
+    PyObject* view = PyMemoryView_FromBuffer(&info);
+    if (!view) {
+        throw Py::Exception();
+    }
+    return Py::asObject(view);
+}
+
+}  // namespace
+
+Py::Object Base::createMemoryView(char format,
+                                  Py_ssize_t itemSize,
+                                  Py_ssize_t rows,
+                                  Py_ssize_t columns,
+                                  void*& data)
+{
+    if (rows == 0) {
+        return createEmptyView(format, itemSize, columns, data);
+    }
+
+    Py::Object array(PyByteArray_FromStringAndSize(nullptr, rows * columns * itemSize), true);
+    data = PyByteArray_AsString(array.ptr());
+
+    Py::Object bytes(PyMemoryView_FromObject(array.ptr()), true);
+    const char fmt[2] = {format, '\0'};
+    PyObject* view = PyObject_CallMethod(bytes.ptr(), "cast", "s(nn)", fmt, rows, columns);
+    if (!view) {
+        throw Py::Exception();
+    }
+    return Py::asObject(view);
+}
+
+std::vector<double> Base::readFloatBuffer(PyObject* obj, Py_ssize_t columns)
+{
+    BufferView buffer(obj);
+    std::vector<double> values;
+    char format = buffer.format();
+    if (format == 'f') {
+        convertItems<float>(buffer.view, values);
+    }
+    else if (format == 'd') {
+        convertItems<double>(buffer.view, values);
+    }
+    else if (!convertIntegers(format, buffer.view, values)) {
+        throw Py::TypeError("buffer must contain numbers in native format");
+    }
+
+    checkColumns(values.size(), columns);
+    return values;
+}
+
+std::vector<unsigned long> Base::readIndexBuffer(PyObject* obj, Py_ssize_t columns)
+{
+    BufferView buffer(obj);
+    std::vector<unsigned long> values;
+    if (!convertIntegers(buffer.format(), buffer.view, values)) {
+        throw Py::TypeError("buffer must contain integers in native format");
+    }
+
+    // negative values of signed formats wrap around
+    for (unsigned long value : values) {
+        if (value > static_cast<unsigned long>(std::numeric_limits<long>::max())) {
+            throw Py::ValueError("buffer must not contain negative indices");
+        }
+    }
+
+    checkColumns(values.size(), columns);
+    return values;
+}
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association                    *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef BASE_PYBUFFER_H
+#define BASE_PYBUFFER_H
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <CXX/Objects.hxx>
+#include <FCGlobal.h>
+
+namespace Base
+{
+
+/**
+ * Creates a writable memoryview of shape (\a rows, \a columns) with items of the
+ * struct module type \a format. An empty view keeps the shape (0, \a columns).
+ * \a data is set to the storage of the view so that the caller can fill it with a
+ * single pass over its own arrays.
+ */
+BaseExport Py::Object
+createMemoryView(char format, Py_ssize_t itemSize, Py_ssize_t rows, Py_ssize_t columns, void*& data);
+
+/// Typed version of createMemoryView() for float, double and std::uint32_t items
+template<typename T>
+Py::Object createMemoryView(Py_ssize_t rows, Py_ssize_t columns, T*& data)
+{
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>
+                      || std::is_same_v<T, std::uint32_t>,
+                  "unsupported item type");
+    char format {};
+    if constexpr (std::is_same_v<T, float>) {
+        format = 'f';
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+        format = 'd';
+    }
+    else {
+        format = 'I';
+    }
+    void* ptr {};
+    Py::Object view = createMemoryView(format, sizeof(T), rows, columns, ptr);
+    data = static_cast<T*>(ptr);
+    return view;
+}
+
+/**
+ * Reads any C-contiguous object supporting the buffer protocol (memoryview, bytes,
+ * array.array, numpy arrays, ...) whose items are floating point or integer numbers.
+ * The number of items must be a multiple of \a columns.
+ * Throws Py::TypeError or Py::ValueError otherwise.
+ */
+BaseExport std::vector<double> readFloatBuffer(PyObject* obj, Py_ssize_t columns);
+/// Same as readFloatBuffer() for non-negative integer items such as indices
+BaseExport std::vector<unsigned long> readIndexBuffer(PyObject* obj, Py_ssize_t columns);
+
+}  // namespace Base
+
+#endif  // BASE_PYBUFFER_H
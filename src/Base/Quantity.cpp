@@ -25,6 +25,8 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <array>
+#include <string_view>
+#include <unordered_map>
 #endif
 
 #include <fmt/format.h>
@@ -561,8 +563,246 @@ private:
 #pragma GCC diagnostic pop
 #endif
 
+namespace
+{
+
+/// The unit symbols of QuantityParser.l, keep both in sync
+const std::unordered_map<std::string_view, const Quantity*>& unitSymbols()
+{
+    static const std::unordered_map<std::string_view, const Quantity*> symbols {
+        {"nm", &Quantity::NanoMetre},
+        {"um", &Quantity::MicroMetre},
+        {"\xC2\xB5" "m", &Quantity::MicroMetre},
+        {"mm", &Quantity::MilliMetre},
+        {"cm", &Quantity::CentiMetre},
+        {"dm", &Quantity::DeciMetre},
+        {"m", &Quantity::Metre},
+        {"km", &Quantity::KiloMetre},
+        {"l", &Quantity::Liter},
+        {"ml", &Quantity::MilliLiter},
+        {"Hz", &Quantity::Hertz},
+        {"kHz", &Quantity::KiloHertz},
+        {"MHz", &Quantity::MegaHertz},
+        {"GHz", &Quantity::GigaHertz},
+        {"THz", &Quantity::TeraHertz},
+        {"ug", &Quantity::MicroGram},
+        {"\xC2\xB5" "g", &Quantity::MicroGram},
+        {"mg", &Quantity::MilliGram},
+        {"g", &Quantity::Gram},
+        {"kg", &Quantity::KiloGram},
+        {"t", &Quantity::Ton},
+        {"s", &Quantity::Second},
+        {"min", &Quantity::Minute},
+        {"h", &Quantity::Hour},
+        {"A", &Quantity::Ampere},
+        {"mA", &Quantity::MilliAmpere},
+        {"kA", &Quantity::KiloAmpere},
+        {"MA", &Quantity::MegaAmpere},
+        {"K", &Quantity::Kelvin},
+        {"mK", &Quantity::MilliKelvin},
+        {"\xC2\xB5" "K", &Quantity::MicroKelvin},
+        {"uK", &Quantity::MicroKelvin},
+        {"mol", &Quantity::Mole},
+        {"mmol", &Quantity::MilliMole},
+        {"cd", &Quantity::Candela},
+        {"in", &Quantity::Inch},
+        {"\"", &Quantity::Inch},
+        {"ft", &Quantity::Foot},
+        {"'", &Quantity::Foot},
+        {"thou", &Quantity::Thou},
+        {"mil", &Quantity::Thou},
+        {"yd", &Quantity::Yard},
+        {"mi", &Quantity::Mile},
+        {"mph", &Quantity::MilePerHour},
+        {"sqft", &Quantity::SquareFoot},
+        {"cft", &Quantity::CubicFoot},
+        {"lb", &Quantity::Pound},
+        {"lbm", &Quantity::Pound},
+        {"oz", &Quantity::Ounce},
+        {"st", &Quantity::Stone},
+        {"cwt", &Quantity::Hundredweights},
+        {"lbf", &Quantity::PoundForce},
+        {"N", &Quantity::Newton},
+        {"mN", &Quantity::MilliNewton},
+        {"kN", &Quantity::KiloNewton},
+        {"MN", &Quantity::MegaNewton},
+        {"Pa", &Quantity::Pascal},
+        {"kPa", &Quantity::KiloPascal},
+        {"MPa", &Quantity::MegaPascal},
+        {"GPa", &Quantity::GigaPascal},
+        {"bar", &Quantity::Bar},
+        {"mbar", &Quantity::MilliBar},
+        {"Torr", &Quantity::Torr},
+        {"mTorr", &Quantity::mTorr},
+        {"uTorr", &Quantity::yTorr},
+        {"\xC2\xB5" "Torr", &Quantity::yTorr},
+        {"psi", &Quantity::PSI},
+        {"ksi", &Quantity::KSI},
+        {"Mpsi", &Quantity::MPSI},
+        {"W", &Quantity::Watt},
+        {"mW", &Quantity::MilliWatt},
+        {"kW", &Quantity::KiloWatt},
+        {"VA", &Quantity::VoltAmpere},
+        {"V", &Quantity::Volt},
+        {"kV", &Quantity::KiloVolt},
+        {"mV", &Quantity::MilliVolt},
+        {"MS", &Quantity::MegaSiemens},
+        {"kS", &Quantity::KiloSiemens},
+        {"S", &Quantity::Siemens},
+        {"mS", &Quantity::MilliSiemens},
+        {"\xC2\xB5" "S", &Quantity::MicroSiemens},
+        {"uS", &Quantity::MicroSiemens},
+        {"Ohm", &Quantity::Ohm},
+        {"kOhm", &Quantity::KiloOhm},
+        {"MOhm", &Quantity::MegaOhm},
+        {"C", &Quantity::Coulomb},
+        {"T", &Quantity::Tesla},
+        {"G", &Quantity::Gauss},
+        {"Wb", &Quantity::Weber},
+        {"F", &Quantity::Farad},
+        {"mF", &Quantity::MilliFarad},
+        {"\xC2\xB5" "F", &Quantity::MicroFarad},
+        {"uF", &Quantity::MicroFarad},
+        {"nF", &Quantity::NanoFarad},
+        {"pF", &Quantity::PicoFarad},
+        {"H", &Quantity::Henry},
+        {"mH", &Quantity::MilliHenry},
+        {"\xC2\xB5" "H", &Quantity::MicroHenry},
+        {"uH", &Quantity::MicroHenry},
+        {"nH", &Quantity::NanoHenry},
+        {"J", &Quantity::Joule},
+        {"mJ", &Quantity::MilliJoule},
+        {"kJ", &Quantity::KiloJoule},
+        {"Nm", &Quantity::NewtonMeter},
+        {"VAs", &Quantity::VoltAmpereSecond},
+        {"CV", &Quantity::WattSecond},
+        {"Ws", &Quantity::WattSecond},
+        {"kWh", &Quantity::KiloWattHour},
+        {"eV", &Quantity::ElectronVolt},
+        {"keV", &Quantity::KiloElectronVolt},
+        {"MeV", &Quantity::MegaElectronVolt},
+        {"cal", &Quantity::Calorie},
+        {"kcal", &Quantity::KiloCalorie},
+        {"\xC2\xB0", &Quantity::Degree},
+        {"deg", &Quantity::Degree},
+        {"rad", &Quantity::Radian},
+        {"gon", &Quantity::Gon},
+        {"M", &Quantity::AngMinute},
+        {"\xE2\x80\xB2", &Quantity::AngMinute},
+        {"AS", &Quantity::AngSecond},
+        {"\xE2\x80\xB3", &Quantity::AngSecond},
+    };
+    return symbols;
+}
+
+bool isBlank(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\n';
+}
+
+bool isDigit(char ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+/**
+ * Handles the common "<number> [<unit>]" input without running the parser. The
+ * number is converted the same way as by the scanner. Returns false for any other
+ * input, which is then left to the grammar.
+ */
+bool parseNumberWithUnit(std::string_view str, Quantity& result)
+{
+    std::size_t pos = 0;
+    auto skipBlanks = [&]() {
+        while (pos < str.size() && isBlank(str[pos])) {
+            ++pos;
+        }
+    };
+
+    skipBlanks();
+    bool negative = false;
+    if (pos < str.size() && str[pos] == '-') {
+        negative = true;
+        ++pos;
+        skipBlanks();
+    }
+
+    std::size_t start = pos;
+    std::size_t digits = 0;
+    while (pos < str.size() && isDigit(str[pos])) {
+        ++pos;
+        ++digits;
+    }
+    if (pos < str.size() && str[pos] == '.') {
+        ++pos;
+        while (pos < str.size() && isDigit(str[pos])) {
+            ++pos;
+            ++digits;
+        }
+    }
+    if (digits == 0) {
+        return false;
+    }
+    if (pos < str.size() && (str[pos] == 'e' || str[pos] == 'E')) {
+        std::size_t expo = pos + 1;
+        if (expo < str.size() && (str[expo] == '+' || str[expo] == '-')) {
+            ++expo;
+        }
+        if (expo >= str.size() || !isDigit(str[expo])) {
+            return false;
+        }
+        while (expo < str.size() && isDigit(str[expo])) {
+            ++expo;
+        }
+        pos = expo;
+    }
+
+    // same buffer size as num_change()
+    const std::size_t num = 40;
+    std::array<char, num> temp {};
+    if (pos - start >= num) {
+        return false;
+    }
+    str.copy(temp.data(), pos - start, start);
+    double value = atof(temp.data());
+    if (negative) {
+        value = -value;
+    }
+
+    skipBlanks();
+    std::size_t unitStart = pos;
+    while (pos < str.size() && !isBlank(str[pos])) {
+        ++pos;
+    }
+    std::string_view symbol = str.substr(unitStart, pos - unitStart);
+    skipBlanks();
+    if (pos != str.size()) {
+        return false;
+    }
+
+    if (symbol.empty()) {
+        result = Quantity(value);
+        return true;
+    }
+
+    const auto& symbols = unitSymbols();
+    auto it = symbols.find(symbol);
+    if (it == symbols.end()) {
+        return false;
+    }
+    result = Quantity(value) * *it->second;
+    return true;
+}
+
+}  // namespace
+
 Quantity Quantity::parse(const std::string& string)
 {
+    Quantity result;
+    if (parseNumberWithUnit(string, result)) {
+        return result;
+    }
+
     // parse from buffer
     QuantityParser::YY_BUFFER_STATE my_string_buffer =
         QuantityParser::yy_scan_string(string.c_str());
@@ -217,17 +217,13 @@ BoundBox3<float_type> Polygon3<float_type>::CalcBoundBox() const
 template<typename float_type>
 void Polygon3<float_type>::Transform(const Base::Matrix4D& mat)
 {
-    for (auto& it : points) {
-        mat.multVec(it, it);
-    }
+    mat.multVec(points.data(), points.data(), points.size());
 }
 
 template<typename float_type>
 void Polygon3<float_type>::Transform(const Base::Placement& plm)
 {
-    for (auto& it : points) {
-        plm.multVec(it, it);
-    }
+    plm.multVec(points.data(), points.data(), points.size());
 }
 
 template<typename float_type>
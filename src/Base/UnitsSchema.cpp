@@ -44,6 +44,11 @@ std::string UnitsSchema::toLocale(const Base::Quantity& quant,
         Lc.setNumberOptions(static_cast<QLocale::NumberOptions>(opt));
     }
 
-    QString Ln = Lc.toString((quant.getValue() / factor), format.toFormat(), format.precision);
-    return QStringLiteral("%1 %2").arg(Ln, QString::fromStdString(unitString)).toStdString();
+    // append the unit to the UTF-8 number directly instead of formatting a second QString
+    std::string result =
+        Lc.toString((quant.getValue() / factor), format.toFormat(), format.precision).toStdString();
+    result.reserve(result.size() + 1 + unitString.size());
+    result += ' ';
+    result += unitString;
+    return result;
 }
@@ -799,12 +799,14 @@ void ViewProviderPath::recomputeBoundingBox()
     MaxZ = -999999999.0;
     Path::Feature* pcPathObj = static_cast<Path::Feature*>(pcObject);
     Base::Placement pl = *(&pcPathObj->Placement.getValue());
-    Base::Vector3d pt;
+    std::vector<Base::Vector3d> points;
+    points.reserve(pcLineCoords->point.getNum());
+    const SbVec3f* coords = pcLineCoords->point.getValues(0);
     for (int i = 1; i < pcLineCoords->point.getNum(); i++) {
-        pt.x = pcLineCoords->point[i].getValue()[0];
-        pt.y = pcLineCoords->point[i].getValue()[1];
-        pt.z = pcLineCoords->point[i].getValue()[2];
-        pl.multVec(pt, pt);
+        points.emplace_back(coords[i][0], coords[i][1], coords[i][2]);
+    }
+    pl.multVec(points.data(), points.data(), points.size());
+    for (const Base::Vector3d& pt : points) {
         if (pt.x < MinX) {
             MinX = pt.x;
         }
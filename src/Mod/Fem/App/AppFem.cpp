@@ -62,6 +62,8 @@
 #include "HypothesisPy.h"
 
 #ifdef FC_USE_VTK
+#include <vtkSMPTools.h>
+
 #include "FemPostFilter.h"
 #include "FemPostFunction.h"
 #include "FemPostPipeline.h"
@@ -205,5 +207,10 @@ PyMOD_INIT_FUNC(Fem)
 #endif
     // clang-format on
 
+#ifdef FC_USE_VTK
+    // let the SMP enabled VTK filters use all cores
+    vtkSMPTools::Initialize();
+#endif
+
     PyMOD_Return(femModule);
 }
@@ -24,14 +24,27 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <map>
 #include <memory>
+#include <sstream>
+#include <tuple>
 
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepClass_FaceClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepTools.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <ElCLib.hxx>
+#include <GeomAPI_ProjectPointOnCurve.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
 #include <SMDS_MeshGroup.hxx>
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
@@ -40,6 +53,7 @@
 #include <SMESH_Group.hxx>
 #include <SMESH_Mesh.hxx>
 #include <SMESH_MeshEditor.hxx>
+#include <Precision.hxx>
 #include <ShapeAnalysis_ShapeTolerance.hxx>
 #include <StdMeshers_Deflection1D.hxx>
 #include <StdMeshers_LocalLength.hxx>
@@ -50,11 +64,13 @@
 #include <StdMeshers_Quadrangle_2D.hxx>
 #include <StdMeshers_Regular_1D.hxx>
 #include <StdMeshers_StartEndLength.hxx>
+#include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
 
 #include <boost/assign/list_of.hpp>
 #include <boost/tokenizer.hpp>  //to simplify parsing input files we use the boost lib
@@ -557,6 +573,228 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
+namespace
+{
+
+/*!
+ * \brief The NodeGrid class is a uniform grid over the (transformed) mesh nodes.
+ * It is built once and then used to find the nodes inside the bounding box of
+ * the shapes to look up, instead of testing every node for every shape.
+ */
+class NodeGrid
+{
+public:
+    NodeGrid(const SMESHDS_Mesh* meshDS, const Base::Matrix4D& mtrx)
+    {
+        SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+        Bnd_Box all;
+        while (aNodeIter->more()) {
+            const SMDS_MeshNode* aNode = aNodeIter->next();
+            double xyz[3];
+            aNode->GetXYZ(xyz);
+            Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
+            // Apply the matrix to hold the BoundBox in absolute space.
+            vec = mtrx * vec;
+            points.emplace_back(vec.x, vec.y, vec.z);
+            ids.push_back(aNode->GetID());
+            all.Add(points.back());
+        }
+        if (points.empty()) {
+            return;
+        }
+
+        double xmax, ymax, zmax;
+        all.Get(origin[0], origin[1], origin[2], xmax, ymax, zmax);
+        double size[3] = {xmax - origin[0], ymax - origin[1], zmax - origin[2]};
+        // aim for a few nodes per cell
+        double volume = 1.0;
+        int nonFlat = 0;
+        for (double length : size) {
+            if (length > Precision::Confusion()) {
+                volume *= length;
+                nonFlat++;
+            }
+        }
+        cellSize = nonFlat > 0
+            ? std::pow(volume * 4.0 / double(points.size()), 1.0 / double(nonFlat))
+            : 1.0;
+        cellSize = std::max(cellSize, Precision::Confusion());
+        for (int i = 0; i < 3; i++) {
+            dims[i] = std::min(1024, int(size[i] / cellSize) + 1);
+        }
+
+        // counting sort of the nodes into the cells
+        std::size_t numCells = std::size_t(dims[0]) * dims[1] * dims[2];
+        cellStart.assign(numCells + 1, 0);
+        std::vector<std::size_t> cellOfPoint(points.size());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            cellOfPoint[i] = cellIndex(cell(points[i].X(), 0),
+                                       cell(points[i].Y(), 1),
+                                       cell(points[i].Z(), 2));
+            cellStart[cellOfPoint[i] + 1]++;
+        }
+        for (std::size_t c = 0; c < numCells; ++c) {
+            cellStart[c + 1] += cellStart[c];
+        }
+        cellItems.resize(points.size());
+        std::vector<std::size_t> fill(cellStart.begin(), cellStart.end() - 1);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            cellItems[fill[cellOfPoint[i]]++] = i;
+        }
+    }
+
+    /// indices of the nodes that are inside box
+    std::vector<std::size_t> query(const Bnd_Box& box) const
+    {
+        std::vector<std::size_t> result;
+        if (points.empty() || box.IsVoid()) {
+            return result;
+        }
+        double lo[3], hi[3];
+        box.Get(lo[0], lo[1], lo[2], hi[0], hi[1], hi[2]);
+        int from[3], to[3];
+        for (int i = 0; i < 3; i++) {
+            from[i] = cell(lo[i], i);
+            to[i] = cell(hi[i], i);
+        }
+        for (int x = from[0]; x <= to[0]; x++) {
+            for (int y = from[1]; y <= to[1]; y++) {
+                for (int z = from[2]; z <= to[2]; z++) {
+                    std::size_t c = cellIndex(x, y, z);
+                    for (std::size_t k = cellStart[c]; k < cellStart[c + 1]; ++k) {
+                        std::size_t i = cellItems[k];
+                        if (!box.IsOut(points[i])) {
+                            result.push_back(i);
+                        }
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    const gp_Pnt& point(std::size_t i) const
+    {
+        return points[i];
+    }
+    int id(std::size_t i) const
+    {
+        return ids[i];
+    }
+    std::size_t size() const
+    {
+        return points.size();
+    }
+
+private:
+    int cell(double value, int axis) const
+    {
+        double pos = (value - origin[axis]) / cellSize;
+        if (pos <= 0.0) {
+            return 0;
+        }
+        return std::min(dims[axis] - 1, int(pos));
+    }
+    std::size_t cellIndex(int x, int y, int z) const
+    {
+        return (std::size_t(z) * dims[1] + y) * dims[0] + x;
+    }
+
+    std::vector<gp_Pnt> points;
+    std::vector<int> ids;
+    double origin[3] = {0.0, 0.0, 0.0};
+    double cellSize = 1.0;
+    int dims[3] = {1, 1, 1};
+    std::vector<std::size_t> cellStart;
+    std::vector<std::size_t> cellItems;
+};
+
+bool isOnShapeExact(const TopoDS_Shape& shape, const gp_Pnt& pnt, double limit)
+{
+    // create a vertex
+    BRepBuilderAPI_MakeVertex aBuilder(pnt);
+    TopoDS_Shape s = aBuilder.Vertex();
+    // measure distance
+    BRepExtrema_DistShapeShape measure(shape, s);
+    measure.Perform();
+    if (!measure.IsDone() || measure.NbSolution() < 1) {
+        return false;
+    }
+    return measure.Value() < limit;
+}
+
+bool isAnalytic(GeomAbs_SurfaceType type)
+{
+    return type == GeomAbs_Plane || type == GeomAbs_Cylinder || type == GeomAbs_Cone
+        || type == GeomAbs_Sphere || type == GeomAbs_Torus;
+}
+
+/*!
+ * Tests a node against a face. The point is projected onto the surface first:
+ * if the foot point lies inside the face the node is accepted. Analytic surfaces
+ * are projected onto the whole untrimmed surface, so the distance is never larger
+ * than the distance to the face and a distance above the limit rejects the node.
+ * Free-form surfaces are projected onto the patch spanned by the face, where the
+ * closest point may be missed. All other cases are decided by
+ * BRepExtrema_DistShapeShape as before.
+ */
+bool isOnFace(const TopoDS_Face& face,
+              const Handle(Geom_Surface)& surface,
+              bool analytic,
+              double umin,
+              double vmin,
+              GeomAPI_ProjectPointOnSurf& projector,
+              const gp_Pnt& pnt,
+              double limit)
+{
+    projector.Perform(pnt);
+    if (projector.NbPoints() > 0) {
+        if (projector.LowerDistance() < limit) {
+            double u, v;
+            projector.LowerDistanceParameters(u, v);
+            // the global projection may return the parameters of another period
+            if (surface->IsUPeriodic()) {
+                u = ElCLib::InPeriod(u, umin, umin + surface->UPeriod());
+            }
+            if (surface->IsVPeriodic()) {
+                v = ElCLib::InPeriod(v, vmin, vmin + surface->VPeriod());
+            }
+            BRepClass_FaceClassifier classifier(face, gp_Pnt2d(u, v), Precision::PConfusion());
+            if (classifier.State() == TopAbs_IN || classifier.State() == TopAbs_ON) {
+                return true;
+            }
+        }
+        else if (analytic) {
+            return false;
+        }
+    }
+    return isOnShapeExact(face, pnt, limit);
+}
+
+/*!
+ * Tests a node against an edge. The distance to a bounded curve is either
+ * a projection inside the parameter range or the distance to one of its ends,
+ * so this is exact without building a vertex for every node.
+ */
+bool isOnEdge(const TopoDS_Edge& edge,
+              const Handle(Geom_Curve)& curve,
+              double first,
+              double last,
+              const gp_Pnt& pnt,
+              double limit)
+{
+    if (curve.IsNull()) {
+        return isOnShapeExact(edge, pnt, limit);
+    }
+    if (pnt.Distance(curve->Value(first)) < limit || pnt.Distance(curve->Value(last)) < limit) {
+        return true;
+    }
+    GeomAPI_ProjectPointOnCurve projector(pnt, curve, first, last);
+    return projector.NbPoints() > 0 && projector.LowerDistance() < limit;
+}
+
+}  // namespace
+
 std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
 {
     std::set<int> result;
@@ -572,41 +810,16 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
                         limit,
                         limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    NodeGrid grid(myMesh->GetMeshDS(), getTransform());
+    std::vector<std::size_t> candidates = grid.query(box);
 
 #pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
+    for (long i = 0; i < long(candidates.size()); ++i) {
+        std::size_t node = candidates[i];
+        if (isOnShapeExact(solid, grid.point(node), limit))
 #pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+        {
+            result.insert(grid.id(node));
         }
     }
     return result;
@@ -614,51 +827,67 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
 
 std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
-    std::set<int> result;
+    return getNodesByFaces(std::vector<TopoDS_Face> {face}).front();
+}
 
-    Bnd_Box box;
-    BRepBndLib::Add(
-        face,
-        box,
-        Standard_False);  // https://forum.freecad.org/viewtopic.php?f=18&t=21571&start=70#p221591
-    // limit where the mesh node belongs to the face:
-    double limit = BRep_Tool::Tolerance(face);
-    box.Enlarge(limit);
+std::vector<std::set<int>> FemMesh::getNodesByFaces(const std::vector<TopoDS_Face>& faces) const
+{
+    std::vector<std::set<int>> result(faces.size());
+    if (faces.empty()) {
+        return result;
+    }
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+    NodeGrid grid(myMesh->GetMeshDS(), getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    for (std::size_t iFace = 0; iFace < faces.size(); ++iFace) {
+        const TopoDS_Face& face = faces[iFace];
+        Bnd_Box box;
+        BRepBndLib::Add(
+            face,
+            box,
+            Standard_False);  // https://forum.freecad.org/viewtopic.php?f=18&t=21571&start=70#p221591
+        // limit where the mesh node belongs to the face:
+        double limit = BRep_Tool::Tolerance(face);
+        box.Enlarge(limit);
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
+        std::vector<std::size_t> candidates = grid.query(box);
+        std::vector<char> onFace(candidates.size(), 0);
 
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
+        Handle(Geom_Surface) surface = BRep_Tool::Surface(face);
+        bool analytic = isAnalytic(BRepAdaptor_Surface(face).GetType());
+        double umin, umax, vmin, vmax;
+        BRepTools::UVBounds(face, umin, umax, vmin, vmax);
+
+#pragma omp parallel
+        {
+            // the projector keeps state, so every thread needs its own one
+            GeomAPI_ProjectPointOnSurf projector;
+            if (!surface.IsNull() && analytic) {
+                projector.Init(surface, Precision::Confusion());
+            }
+            else if (!surface.IsNull()) {
+                projector.Init(surface, umin, umax, vmin, vmax, Precision::Confusion());
             }
 
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
+#pragma omp for schedule(dynamic, 64)
+            for (long i = 0; i < long(candidates.size()); ++i) {
+                const gp_Pnt& pnt = grid.point(candidates[i]);
+                bool found = surface.IsNull() ? isOnShapeExact(face, pnt, limit)
+                                              : isOnFace(face,
+                                                         surface,
+                                                         analytic,
+                                                         umin,
+                                                         vmin,
+                                                         projector,
+                                                         pnt,
+                                                         limit);
+                onFace[i] = found ? 1 : 0;
+            }
+        }
+
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            if (onFace[i]) {
+                result[iFace].insert(grid.id(candidates[i]));
             }
         }
     }
@@ -668,48 +897,45 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 
 std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
-    std::set<int> result;
+    return getNodesByEdges(std::vector<TopoDS_Edge> {edge}).front();
+}
 
-    Bnd_Box box;
-    BRepBndLib::Add(edge, box);
-    // limit where the mesh node belongs to the edge:
-    double limit = BRep_Tool::Tolerance(edge);
-    box.Enlarge(limit);
+std::vector<std::set<int>> FemMesh::getNodesByEdges(const std::vector<TopoDS_Edge>& edges) const
+{
+    std::vector<std::set<int>> result(edges.size());
+    if (edges.empty()) {
+        return result;
+    }
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+    NodeGrid grid(myMesh->GetMeshDS(), getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    for (std::size_t iEdge = 0; iEdge < edges.size(); ++iEdge) {
+        const TopoDS_Edge& edge = edges[iEdge];
+        Bnd_Box box;
+        BRepBndLib::Add(edge, box);
+        // limit where the mesh node belongs to the edge:
+        double limit = BRep_Tool::Tolerance(edge);
+        box.Enlarge(limit);
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
+        std::vector<std::size_t> candidates = grid.query(box);
+        std::vector<char> onEdge(candidates.size(), 0);
 
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+        double first {0.0};
+        double last {0.0};
+        Handle(Geom_Curve) curve;
+        if (!BRep_Tool::Degenerated(edge)) {
+            curve = BRep_Tool::Curve(edge, first, last);
+        }
 
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
+#pragma omp parallel for schedule(dynamic, 64)
+        for (long i = 0; i < long(candidates.size()); ++i) {
+            const gp_Pnt& pnt = grid.point(candidates[i]);
+            onEdge[i] = isOnEdge(edge, curve, first, last, pnt, limit) ? 1 : 0;
+        }
+
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            if (onEdge[i]) {
+                result[iEdge].insert(grid.id(candidates[i]));
             }
         }
     }
@@ -1652,6 +1878,54 @@ void FemMesh::writeVTK(const std::string& fileName, bool highest) const
     FemVTKTools::writeVTKMesh(fileName.c_str(), this, highest);
 }
 
+namespace
+{
+
+// Lines of large node and element blocks are formatted in chunks in parallel
+// and written in their original order.
+template<typename T, typename Format>
+void writeLinesParallel(std::ostream& out, const std::vector<T>& items, Format format)
+{
+    const std::size_t chunkSize = 8192;
+    // bound the memory used for formatted but not yet written text
+    const std::size_t chunksPerBatch = 64;
+    std::size_t numChunks = (items.size() + chunkSize - 1) / chunkSize;
+    std::vector<std::string> text;
+    for (std::size_t batch = 0; batch < numChunks; batch += chunksPerBatch) {
+        std::size_t batchEnd = std::min(numChunks, batch + chunksPerBatch);
+        text.assign(batchEnd - batch, std::string());
+
+#pragma omp parallel for schedule(dynamic)
+        for (long chunk = long(batch); chunk < long(batchEnd); ++chunk) {
+            std::ostringstream str;
+            str.imbue(out.getloc());
+            str.precision(out.precision());
+            std::size_t end = std::min(items.size(), (chunk + 1) * chunkSize);
+            for (std::size_t i = chunk * chunkSize; i < end; ++i) {
+                format(str, items[i]);
+            }
+            text[chunk - batch] = str.str();
+        }
+
+        for (const auto& it : text) {
+            out << it;
+        }
+    }
+}
+
+template<typename Map>
+std::vector<const typename Map::value_type*> elementList(const Map& elements)
+{
+    std::vector<const typename Map::value_type*> list;
+    list.reserve(elements.size());
+    for (const auto& it : elements) {
+        list.push_back(&it);
+    }
+    return list;
+}
+
+}  // namespace
+
 void FemMesh::writeABAQUS(const std::string& Filename,
                           int elemParam,
                           bool groupParam,
@@ -2008,30 +2282,30 @@ void FemMesh::writeABAQUS(const std::string& Filename,
 
     // add some text and make sure one of the known elemParam values is used
     anABAQUS_Output << "** written by FreeCAD inp file writer for CalculiX,Abaqus meshes"
-                    << std::endl;
+                    << '\n';
     switch (elemParam) {
         case 0:
-            anABAQUS_Output << "** all mesh elements." << std::endl << std::endl;
+            anABAQUS_Output << "** all mesh elements." << '\n' << '\n';
             break;
         case 1:
-            anABAQUS_Output << "** highest dimension mesh elements only." << std::endl << std::endl;
+            anABAQUS_Output << "** highest dimension mesh elements only." << '\n' << '\n';
             break;
         case 2:
             anABAQUS_Output << "** FEM mesh elements only (edges if they do not belong to faces "
                                "and faces if they do not belong to volumes)."
-                            << std::endl
-                            << std::endl;
+                            << '\n'
+                            << '\n';
             break;
         default:
-            anABAQUS_Output << "** Problem on writing" << std::endl;
+            anABAQUS_Output << "** Problem on writing" << '\n';
             anABAQUS_Output.close();
             throw std::runtime_error(
                 "Unknown ABAQUS element choice parameter, [0|1|2] are allowed.");
     }
 
     // write nodes
-    anABAQUS_Output << "** Nodes" << std::endl;
-    anABAQUS_Output << "*Node, NSET=Nall" << std::endl;
+    anABAQUS_Output << "** Nodes" << '\n';
+    anABAQUS_Output << "*Node, NSET=Nall" << '\n';
 
     // Axisymmetric, plane strain and plane stress elements expect nodes in the plane z=0.
     // Set the z coordinate to 0 to avoid possible rounding errors.
@@ -2058,11 +2332,16 @@ void FemMesh::writeABAQUS(const std::string& Filename,
 
     // This way we get sorted output.
     // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
+    std::vector<const VertexMap::value_type*> vertices;
+    vertices.reserve(vertexMap.size());
     for (const auto& it : vertexMap) {
-        anABAQUS_Output << it.first << ", " << it.second.x << ", " << it.second.y << ", "
-                        << it.second.z << std::endl;
+        vertices.push_back(&it);
     }
-    anABAQUS_Output << std::endl << std::endl;
+    writeLinesParallel(anABAQUS_Output, vertices, [](std::ostream& str, const auto* it) {
+        str << it->first << ", " << it->second.x << ", " << it->second.y << ", " << it->second.z
+            << '\n';
+    });
+    anABAQUS_Output << '\n' << '\n';
     ;
 
 
@@ -2070,46 +2349,52 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     std::string elsetname;
     if (!elementsMapVol.empty()) {
         for (const auto& it : elementsMapVol) {
-            anABAQUS_Output << "** Volume elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                // Calculix allows max 16 entries in one line, a hexa20 has more !
-                int ct = 0;  // counter
-                bool first_line = true;
-                for (auto kt = jt.second.begin(); kt != jt.second.end(); ++kt, ++ct) {
-                    if (ct < 15) {
-                        anABAQUS_Output << ", " << *kt;
-                    }
-                    else {
-                        if (first_line) {
-                            anABAQUS_Output << "," << std::endl << *kt;
-                            first_line = false;
-                        }
-                        else {
-                            anABAQUS_Output << ", " << *kt;
-                        }
-                    }
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Volume elements" << '\n';
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << '\n';
+            writeLinesParallel(anABAQUS_Output,
+                               elementList(it.second),
+                               [](std::ostream& str, const auto* jt) {
+                                   str << jt->first;
+                                   // Calculix allows max 16 entries in one line, a hexa20 has
+                                   // more !
+                                   int ct = 0;  // counter
+                                   bool first_line = true;
+                                   for (auto kt = jt->second.begin(); kt != jt->second.end();
+                                        ++kt, ++ct) {
+                                       if (ct < 15) {
+                                           str << ", " << *kt;
+                                       }
+                                       else {
+                                           if (first_line) {
+                                               str << "," << '\n' << *kt;
+                                               first_line = false;
+                                           }
+                                           else {
+                                               str << ", " << *kt;
+                                           }
+                                       }
+                                   }
+                                   str << '\n';
+                               });
         }
         elsetname += "Evolumes";
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write faces to file
     if (!elementsMapFac.empty()) {
         for (const auto& it : elementsMapFac) {
-            anABAQUS_Output << "** Face elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Face elements" << '\n';
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << '\n';
+            writeLinesParallel(anABAQUS_Output,
+                               elementList(it.second),
+                               [](std::ostream& str, const auto* jt) {
+                                   str << jt->first;
+                                   for (int kt : jt->second) {
+                                       str << ", " << kt;
+                                   }
+                                   str << '\n';
+                               });
         }
         if (elsetname.empty()) {
             elsetname += "Efaces";
@@ -2117,21 +2402,23 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         else {
             elsetname += ", Efaces";
         }
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write edges to file
     if (!elementsMapEdg.empty()) {
         for (const auto& it : elementsMapEdg) {
-            anABAQUS_Output << "** Edge elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Edge elements" << '\n';
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << '\n';
+            writeLinesParallel(anABAQUS_Output,
+                               elementList(it.second),
+                               [](std::ostream& str, const auto* jt) {
+                                   str << jt->first;
+                                   for (int kt : jt->second) {
+                                       str << ", " << kt;
+                                   }
+                                   str << '\n';
+                               });
         }
         if (elsetname.empty()) {
             elsetname += "Eedges";
@@ -2139,13 +2426,13 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         else {
             elsetname += ", Eedges";
         }
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write elset Eall
-    anABAQUS_Output << "** Define element set Eall" << std::endl;
-    anABAQUS_Output << "*ELSET, ELSET=Eall" << std::endl;
-    anABAQUS_Output << elsetname << std::endl;
+    anABAQUS_Output << "** Define element set Eall" << '\n';
+    anABAQUS_Output << "*ELSET, ELSET=Eall" << '\n';
+    anABAQUS_Output << elsetname << '\n';
 
     // groups
     if (!groupParam) {
@@ -2153,7 +2440,7 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     }
     else {
         // get and write group data
-        anABAQUS_Output << std::endl << "** Group data" << std::endl;
+        anABAQUS_Output << '\n' << "** Group data" << '\n';
 
         std::list<int> groupIDs = myMesh->GetGroupIds();
         for (int it : groupIDs) {
@@ -2191,13 +2478,13 @@ void FemMesh::writeABAQUS(const std::string& Filename,
             }
             const char* groupName = myMesh->GetGroup(it)->GetName();
             anABAQUS_Output << "** GroupID: " << (it) << " --> GroupName: " << groupName
-                            << " --> GroupElementType: " << groupElementType << std::endl;
+                            << " --> GroupElementType: " << groupElementType << '\n';
 
             if (aElementType == SMDSAbs_Node) {
-                anABAQUS_Output << "*NSET, NSET=" << groupName << std::endl;
+                anABAQUS_Output << "*NSET, NSET=" << groupName << '\n';
             }
             else {
-                anABAQUS_Output << "*ELSET, ELSET=" << groupName << std::endl;
+                anABAQUS_Output << "*ELSET, ELSET=" << groupName << '\n';
             }
 
             // get and write group elements
@@ -2208,11 +2495,11 @@ void FemMesh::writeABAQUS(const std::string& Filename,
                 ids.insert(aElement->GetID());
             }
             for (int it : ids) {
-                anABAQUS_Output << it << std::endl;
+                anABAQUS_Output << it << '\n';
             }
 
             // write newline after each group
-            anABAQUS_Output << std::endl;
+            anABAQUS_Output << '\n';
         }
         anABAQUS_Output.close();
     }
@@ -2309,7 +2596,8 @@ void FemMesh::Save(Base::Writer& writer) const
     if (!writer.isForceXML()) {
         // See SaveDocFile(), RestoreDocFile()
         writer.Stream() << writer.ind() << "<FemMesh file=\"";
-        writer.Stream() << writer.addFile("FemMesh.unv", this) << "\"";
+        writer.Stream() << writer.addFile(saveAsBinary() ? "FemMesh.bin" : "FemMesh.unv", this)
+                        << "\"";
         writer.Stream() << " a11=\"" << _Mtrx[0][0] << "\" a12=\"" << _Mtrx[0][1] << "\" a13=\""
                         << _Mtrx[0][2] << "\" a14=\"" << _Mtrx[0][3] << "\"";
         writer.Stream() << " a21=\"" << _Mtrx[1][0] << "\" a22=\"" << _Mtrx[1][1] << "\" a23=\""
@@ -2366,8 +2654,330 @@ void FemMesh::Restore(Base::XMLReader& reader)
     }
 }
 
+namespace
+{
+
+// Version of the binary mesh format written by FemMesh::SaveDocFile()
+const uint32_t BinaryMeshVersion = 1;
+
+// Upper bound of the vector capacity reserved from a count in the file. Larger
+// vectors grow while they are read, so that a corrupt count can't allocate more
+// memory than the file provides data for.
+const uint32_t MaxReserve = 1 << 16;
+
+/*!
+ * Elements of the same type, polygon/polyhedron flag, quadratic polygon flag and
+ * number of nodes are written as one block so that the connectivity of a block is
+ * a plain array. Polygons, polyhedra and balls carry their per-element data inline.
+ */
+struct ElementBlock
+{
+    int32_t type {};
+    bool isPoly {false};
+    bool isQuad {false};  // quadratic polygons, the node count can't tell them apart
+    uint32_t nbNodes {0};  // 0 for elements with a varying number of nodes
+    std::vector<const SMDS_MeshElement*> elements;
+};
+
+std::vector<int> getPolyhedronQuantities(const SMDS_MeshElement* elem)
+{
+#if SMESH_VERSION_MAJOR >= 9
+    return static_cast<const SMDS_MeshVolume*>(elem)->GetQuantities();
+#else
+    return static_cast<const SMDS_VtkVolume*>(elem)->GetQuantities();
+#endif
+}
+
+void writeString(Base::OutputStream& str, const std::string& text)
+{
+    str << uint32_t(text.size());
+    str.write(text.c_str(), int(text.size()));
+}
+
+void checkStream(const Base::InputStream& str)
+{
+    if (!str) {
+        throw Base::FileException("Unexpected end of binary FEM mesh");
+    }
+}
+
+template<typename T>
+T readValue(Base::InputStream& str)
+{
+    T value {};
+    str >> value;
+    checkStream(str);
+    return value;
+}
+
+std::string readString(Base::InputStream& str)
+{
+    auto length = readValue<uint32_t>(str);
+    std::string text;
+    char buffer[256];
+    while (length > 0) {
+        uint32_t size = std::min<uint32_t>(length, sizeof(buffer));
+        str.read(buffer, int(size));
+        checkStream(str);
+        text.append(buffer, size);
+        length -= size;
+    }
+    return text;
+}
+
+void writeBinaryMesh(Base::OutputStream& str, SMESH_Mesh* mesh)
+{
+    SMESHDS_Mesh* meshDS = mesh->GetMeshDS();
+    str << BinaryMeshVersion;
+
+    // nodes: ids first, then the coordinate array
+    std::vector<const SMDS_MeshNode*> nodes;
+    nodes.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+    while (aNodeIter->more()) {
+        nodes.push_back(aNodeIter->next());
+    }
+    str << uint32_t(nodes.size());
+    for (const SMDS_MeshNode* node : nodes) {
+        str << int32_t(node->GetID());
+    }
+    for (const SMDS_MeshNode* node : nodes) {
+        str << node->X() << node->Y() << node->Z();
+    }
+
+    // elements grouped into blocks
+    std::vector<ElementBlock> blocks;
+    std::map<std::tuple<int, bool, bool, int>, std::size_t> blockIndex;
+    SMDS_ElemIteratorPtr aElemIter = meshDS->elementsIterator();
+    while (aElemIter->more()) {
+        const SMDS_MeshElement* elem = aElemIter->next();
+        if (elem->GetType() == SMDSAbs_Node) {
+            continue;
+        }
+        bool varying = elem->IsPoly() || elem->GetEntityType() == SMDSEntity_Polyhedra;
+        int nbNodes = varying ? 0 : elem->NbNodes();
+        bool isQuad = elem->IsPoly() && elem->IsQuadratic();
+        auto key = std::make_tuple(int(elem->GetType()), elem->IsPoly(), isQuad, nbNodes);
+        auto it = blockIndex.find(key);
+        if (it == blockIndex.end()) {
+            it = blockIndex.emplace(key, blocks.size()).first;
+            ElementBlock block;
+            block.type = elem->GetType();
+            block.isPoly = elem->IsPoly();
+            block.isQuad = isQuad;
+            block.nbNodes = nbNodes;
+            blocks.push_back(block);
+        }
+        blocks[it->second].elements.push_back(elem);
+    }
+
+    str << uint32_t(blocks.size());
+    for (const ElementBlock& block : blocks) {
+        str << block.type << block.isPoly << block.isQuad << block.nbNodes
+            << uint32_t(block.elements.size());
+        for (const SMDS_MeshElement* elem : block.elements) {
+            str << int32_t(elem->GetID());
+        }
+        std::vector<int32_t> nodeIds;
+        for (const SMDS_MeshElement* elem : block.elements) {
+            // for polyhedra the iterator runs over the nodes of all faces
+            nodeIds.clear();
+            SMDS_ElemIteratorPtr nIt = elem->nodesIterator();
+            while (nIt->more()) {
+                nodeIds.push_back(int32_t(nIt->next()->GetID()));
+            }
+            if (block.nbNodes == 0) {
+                str << uint32_t(nodeIds.size());
+            }
+            for (int32_t id : nodeIds) {
+                str << id;
+            }
+            if (elem->GetEntityType() == SMDSEntity_Polyhedra) {
+                std::vector<int> quantities = getPolyhedronQuantities(elem);
+                str << uint32_t(quantities.size());
+                for (int quantity : quantities) {
+                    str << int32_t(quantity);
+                }
+            }
+            else if (elem->GetEntityType() == SMDSEntity_Ball) {
+                str << static_cast<const SMDS_BallElement*>(elem)->GetDiameter();
+            }
+        }
+    }
+
+    // groups
+    std::vector<SMESH_Group*> groups;
+    SMESH_Mesh::GroupIteratorPtr gIt = mesh->GetGroups();
+    while (gIt->more()) {
+        groups.push_back(gIt->next());
+    }
+    str << uint32_t(groups.size());
+    for (SMESH_Group* group : groups) {
+        const SMESHDS_GroupBase* groupDS = group->GetGroupDS();
+        writeString(str, group->GetName());
+        str << int32_t(groupDS->GetType()) << uint32_t(groupDS->Extent());
+        SMDS_ElemIteratorPtr eIt = groupDS->GetElements();
+        while (eIt->more()) {
+            str << int32_t(eIt->next()->GetID());
+        }
+    }
+}
+
+/*!
+ * Reads a mesh written by writeBinaryMesh(). The file may be corrupt, so every count
+ * is only trusted as far as the stream provides data for it, and element types, node
+ * references and polyhedron face sizes are checked before they are passed to SMESH.
+ */
+void readBinaryMesh(Base::InputStream& str, SMESH_Mesh* mesh)
+{
+    SMESHDS_Mesh* meshDS = mesh->GetMeshDS();
+    SMESH_MeshEditor editor(mesh);
+
+    auto version = readValue<uint32_t>(str);
+    if (version == 0 || version > BinaryMeshVersion) {
+        throw Base::FileException("Unsupported version of binary FEM mesh");
+    }
+
+    // nodes
+    auto nbNodes = readValue<uint32_t>(str);
+    std::vector<int32_t> nodeIds;
+    nodeIds.reserve(std::min(nbNodes, MaxReserve));
+    for (uint32_t i = 0; i < nbNodes; i++) {
+        nodeIds.push_back(readValue<int32_t>(str));
+    }
+    for (int32_t id : nodeIds) {
+        double x {}, y {}, z {};
+        str >> x >> y >> z;
+        checkStream(str);
+        meshDS->AddNodeWithID(x, y, z, id);
+    }
+
+    auto findNode = [meshDS](int32_t id) {
+        const SMDS_MeshNode* node = meshDS->FindNode(id);
+        if (!node) {
+            throw Base::FileException("Invalid node reference in binary FEM mesh");
+        }
+        return node;
+    };
+
+    // elements
+    auto nbBlocks = readValue<uint32_t>(str);
+    std::vector<const SMDS_MeshNode*> nodes;
+    std::vector<int32_t> elemIds;
+    for (uint32_t i = 0; i < nbBlocks; i++) {
+        auto type = readValue<int32_t>(str);
+        bool isPoly = readValue<uint8_t>(str) != 0;
+        bool isQuad = readValue<uint8_t>(str) != 0;
+        auto nbElemNodes = readValue<uint32_t>(str);
+        auto nbElements = readValue<uint32_t>(str);
+        if (type < SMDSAbs_Edge || type > SMDSAbs_Ball) {
+            throw Base::FileException("Invalid element type in binary FEM mesh");
+        }
+        auto elemType = static_cast<SMDSAbs_ElementType>(type);
+
+        elemIds.clear();
+        elemIds.reserve(std::min(nbElements, MaxReserve));
+        for (uint32_t j = 0; j < nbElements; j++) {
+            elemIds.push_back(readValue<int32_t>(str));
+        }
+        for (int32_t ID : elemIds) {
+            uint32_t count = nbElemNodes;
+            if (count == 0) {
+                count = readValue<uint32_t>(str);
+            }
+            nodes.clear();
+            nodes.reserve(std::min(count, MaxReserve));
+            for (uint32_t j = 0; j < count; j++) {
+                nodes.push_back(findNode(readValue<int32_t>(str)));
+            }
+
+            const SMDS_MeshElement* elem = nullptr;
+            if (elemType == SMDSAbs_Volume && isPoly) {
+                auto nbQuantities = readValue<uint32_t>(str);
+                std::vector<int> quantities;
+                quantities.reserve(std::min(nbQuantities, MaxReserve));
+                std::size_t nbFaceNodes = 0;
+                for (uint32_t j = 0; j < nbQuantities; j++) {
+                    auto quantity = readValue<int32_t>(str);
+                    if (quantity < 3) {
+                        throw Base::FileException("Invalid polyhedron in binary FEM mesh");
+                    }
+                    quantities.push_back(quantity);
+                    nbFaceNodes += std::size_t(quantity);
+                }
+                if (nbFaceNodes != nodes.size()) {
+                    throw Base::FileException("Invalid polyhedron in binary FEM mesh");
+                }
+                elem = meshDS->AddPolyhedralVolumeWithID(nodes, quantities, ID);
+            }
+            else if (elemType == SMDSAbs_Ball) {
+                auto diameter = readValue<double>(str);
+                SMESH_MeshEditor::ElemFeatures elemFeat;
+                elemFeat.Init(diameter);
+                elemFeat.SetID(ID);
+                elem = editor.AddElement(nodes, elemFeat);
+            }
+            else {
+                SMESH_MeshEditor::ElemFeatures elemFeat(elemType, isPoly, isQuad);
+                elemFeat.SetID(ID);
+                elem = editor.AddElement(nodes, elemFeat);
+            }
+            if (!elem) {
+                throw Base::FileException("Invalid element in binary FEM mesh");
+            }
+        }
+    }
+
+    // groups
+    auto nbGroups = readValue<uint32_t>(str);
+    for (uint32_t i = 0; i < nbGroups; i++) {
+        std::string name = readString(str);
+        auto type = readValue<int32_t>(str);
+        auto nbMembers = readValue<uint32_t>(str);
+        if (type < SMDSAbs_Node || type > SMDSAbs_Ball) {
+            throw Base::FileException("Invalid group type in binary FEM mesh");
+        }
+        auto groupType = static_cast<SMDSAbs_ElementType>(type);
+
+        int aId = -1;
+        SMESH_Group* group = mesh->AddGroup(groupType, name.c_str(), aId);
+        SMESHDS_Group* groupDS = dynamic_cast<SMESHDS_Group*>(group->GetGroupDS());
+        for (uint32_t j = 0; j < nbMembers; j++) {
+            auto id = readValue<int32_t>(str);
+            if (!groupDS) {
+                continue;
+            }
+            const SMDS_MeshElement* elem = groupType == SMDSAbs_Node
+                ? static_cast<const SMDS_MeshElement*>(meshDS->FindNode(id))
+                : meshDS->FindElement(id);
+            if (elem) {
+                groupDS->SMDSGroup().Add(elem);
+            }
+        }
+    }
+
+    meshDS->Modified();
+}
+
+}  // namespace
+
+bool FemMesh::saveAsBinary()
+{
+    // older versions can only read FemMesh.unv, so the binary format is an opt-in
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/General");
+    return hGrp->GetBool("BinaryMeshFormat", false);
+}
+
 void FemMesh::SaveDocFile(Base::Writer& writer) const
 {
+    if (saveAsBinary()) {
+        // write the mesh data directly in binary form, see RestoreDocFile()
+        Base::OutputStream str(writer.Stream());
+        writeBinaryMesh(str, myMesh);
+        return;
+    }
+
     // create a temporary file and copy the content to the zip stream
     Base::FileInfo fi(App::Application::getTempFileName().c_str());
 
@@ -2386,6 +2996,15 @@ void FemMesh::SaveDocFile(Base::Writer& writer) const
 
 void FemMesh::RestoreDocFile(Base::Reader& reader)
 {
+    Base::FileInfo mesh(reader.getFileName());
+    if (mesh.hasExtension("bin")) {
+        Base::InputStream str(reader);
+        readBinaryMesh(str, myMesh);
+        return;
+    }
+
+    // the mesh is stored as UNV file unless the binary format is enabled
+
     // create a temporary file and copy the content from the zip stream
     Base::FileInfo fi(App::Application::getTempFileName().c_str());
 
@@ -2406,14 +3025,28 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
     // We perform a translation and rotation of the current active Mesh object
-    Base::Matrix4D clMatrix(rclTrf);
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    Base::Vector3d current_node;
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    std::vector<const SMDS_MeshNode*> nodes;
+    std::vector<double> x, y, z;
+    nodes.reserve(meshDS->NbNodes());
+    x.reserve(meshDS->NbNodes());
+    y.reserve(meshDS->NbNodes());
+    z.reserve(meshDS->NbNodes());
+
+    // the nodes are not stored contiguously, so their coordinates are gathered
+    // for the batch transformation and written back afterwards
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
     for (; aNodeIter->more();) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
-        current_node.Set(aNode->X(), aNode->Y(), aNode->Z());
-        current_node = clMatrix * current_node;
-        myMesh->GetMeshDS()->MoveNode(aNode, current_node.x, current_node.y, current_node.z);
+        nodes.push_back(aNode);
+        x.push_back(aNode->X());
+        y.push_back(aNode->Y());
+        z.push_back(aNode->Z());
+    }
+
+    rclTrf.multVec(x.data(), y.data(), z.data(), nodes.size());
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        meshDS->MoveNode(nodes[i], x[i], y[i], z[i]);
     }
 }
 
@@ -134,6 +134,10 @@ public:
     std::set<int> getNodesByFace(const TopoDS_Face& face) const;
     /// retrieving by edge
     std::set<int> getNodesByEdge(const TopoDS_Edge& edge) const;
+    /// retrieving by several faces at once, one node set per face
+    std::vector<std::set<int>> getNodesByFaces(const std::vector<TopoDS_Face>& faces) const;
+    /// retrieving by several edges at once, one node set per edge
+    std::vector<std::set<int>> getNodesByEdges(const std::vector<TopoDS_Edge>& edges) const;
     /// retrieving by vertex
     std::set<int> getNodesByVertex(const TopoDS_Vertex& vertex) const;
     /// retrieving node IDs by element ID
@@ -219,6 +223,8 @@ private:
     void readNastran95(const std::string& Filename);
     void readZ88(const std::string& Filename);
     void readAbaqus(const std::string& Filename);
+    /// true if the mesh is saved as FemMesh.bin instead of FemMesh.unv
+    static bool saveAsBinary();
 
 private:
     /// positioning matrix
@@ -496,6 +496,62 @@ PyObject* FemMeshPy::addQuad(PyObject* args)
     }
 }
 
+PyObject* FemMeshPy::addPolygon(PyObject* args)
+{
+    PyObject* obj;
+    PyObject* quadratic = Py_False;
+    int ElementId = -1;
+    if (!PyArg_ParseTuple(args,
+                          "O!|O!i",
+                          &PyList_Type,
+                          &obj,
+                          &PyBool_Type,
+                          &quadratic,
+                          &ElementId)) {
+        return nullptr;
+    }
+
+    try {
+        SMESHDS_Mesh* meshDS = getFemMeshPtr()->getSMesh()->GetMeshDS();
+        Py::List list(obj);
+        std::vector<const SMDS_MeshNode*> Nodes;
+        for (Py::List::iterator it = list.begin(); it != list.end(); ++it) {
+            Py::Long NoNr(*it);
+            const SMDS_MeshNode* node = meshDS->FindNode(NoNr);
+            if (!node) {
+                throw std::runtime_error("Failed to get node of the given indices");
+            }
+            Nodes.push_back(node);
+        }
+
+        SMDS_MeshFace* face = nullptr;
+        if (Base::asBoolean(quadratic)) {
+            // corner nodes first, then the mid-side nodes
+            if (Nodes.size() < 6 || Nodes.size() % 2 != 0) {
+                throw std::runtime_error(
+                    "A quadratic polygon needs an even number of at least 6 nodes");
+            }
+            face = ElementId != -1 ? meshDS->AddQuadPolygonalFaceWithID(Nodes, ElementId)
+                                   : meshDS->AddQuadPolygonalFace(Nodes);
+        }
+        else {
+            if (Nodes.size() < 3) {
+                throw std::runtime_error("A polygon needs at least 3 nodes");
+            }
+            face = ElementId != -1 ? meshDS->AddPolygonalFaceWithID(Nodes, ElementId)
+                                   : meshDS->AddPolygonalFace(Nodes);
+        }
+        if (!face) {
+            throw std::runtime_error("Failed to add polygon");
+        }
+        return Py::new_reference_to(Py::Long(face->GetID()));
+    }
+    catch (const std::exception& e) {
+        PyErr_SetString(Base::PyExc_FC_GeneralError, e.what());
+        return nullptr;
+    }
+}
+
 PyObject* FemMeshPy::addVolume(PyObject* args)
 {
     SMESH_Mesh* mesh = getFemMeshPtr()->getSMesh();
@@ -809,6 +865,55 @@ PyObject* FemMeshPy::addVolume(PyObject* args)
     return nullptr;
 }
 
+PyObject* FemMeshPy::addPolyhedron(PyObject* args)
+{
+    PyObject* obj;
+    PyObject* quant;
+    int ElementId = -1;
+    if (!PyArg_ParseTuple(args, "O!O!|i", &PyList_Type, &obj, &PyList_Type, &quant, &ElementId)) {
+        return nullptr;
+    }
+
+    try {
+        SMESHDS_Mesh* meshDS = getFemMeshPtr()->getSMesh()->GetMeshDS();
+        Py::List list(obj);
+        std::vector<const SMDS_MeshNode*> Nodes;
+        for (Py::List::iterator it = list.begin(); it != list.end(); ++it) {
+            Py::Long NoNr(*it);
+            const SMDS_MeshNode* node = meshDS->FindNode(NoNr);
+            if (!node) {
+                throw std::runtime_error("Failed to get node of the given indices");
+            }
+            Nodes.push_back(node);
+        }
+
+        // the number of nodes of each face, the nodes of all faces are concatenated
+        Py::List quantList(quant);
+        std::vector<int> quantities;
+        std::size_t total = 0;
+        for (Py::List::iterator it = quantList.begin(); it != quantList.end(); ++it) {
+            long count = Py::Long(*it);
+            quantities.push_back(int(count));
+            total += count;
+        }
+        if (quantities.size() < 4 || total != Nodes.size()) {
+            throw std::runtime_error("The node counts of the faces do not match the node list");
+        }
+
+        SMDS_MeshVolume* vol = ElementId != -1
+            ? meshDS->AddPolyhedralVolumeWithID(Nodes, quantities, ElementId)
+            : meshDS->AddPolyhedralVolume(Nodes, quantities);
+        if (!vol) {
+            throw std::runtime_error("Failed to add polyhedron");
+        }
+        return Py::new_reference_to(Py::Long(vol->GetID()));
+    }
+    catch (const std::exception& e) {
+        PyErr_SetString(Base::PyExc_FC_GeneralError, e.what());
+        return nullptr;
+    }
+}
+
 PyObject* FemMeshPy::addEdgeList(PyObject* args)
 {
     PyObject* nodesObj = nullptr;
@@ -1472,6 +1577,98 @@ PyObject* FemMeshPy::getNodesByEdge(PyObject* args)
     }
 }
 
+PyObject* FemMeshPy::getNodesByFaces(PyObject* args)
+{
+    PyObject* pW;
+    if (!PyArg_ParseTuple(args, "O", &pW)) {
+        return nullptr;
+    }
+
+    try {
+        std::vector<TopoDS_Face> faces;
+        Py::Sequence list(pW);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            PyObject* item = (*it).ptr();
+            if (!PyObject_TypeCheck(item, &(Part::TopoShapeFacePy::Type))) {
+                PyErr_SetString(PyExc_TypeError, "Sequence of faces expected");
+                return nullptr;
+            }
+            const TopoDS_Shape& sh =
+                static_cast<Part::TopoShapeFacePy*>(item)->getTopoShapePtr()->getShape();
+            if (sh.IsNull()) {
+                PyErr_SetString(PyExc_ValueError, "Face is empty");
+                return nullptr;
+            }
+            faces.push_back(TopoDS::Face(sh));
+        }
+
+        Py::List ret;
+        std::vector<std::set<int>> resultSets = getFemMeshPtr()->getNodesByFaces(faces);
+        for (const auto& resultSet : resultSets) {
+            Py::List nodes;
+            for (int it : resultSet) {
+                nodes.append(Py::Long(it));
+            }
+            ret.append(nodes);
+        }
+
+        return Py::new_reference_to(ret);
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+    catch (Standard_Failure& e) {
+        PyErr_SetString(Base::PyExc_FC_CADKernelError, e.GetMessageString());
+        return nullptr;
+    }
+}
+
+PyObject* FemMeshPy::getNodesByEdges(PyObject* args)
+{
+    PyObject* pW;
+    if (!PyArg_ParseTuple(args, "O", &pW)) {
+        return nullptr;
+    }
+
+    try {
+        std::vector<TopoDS_Edge> edges;
+        Py::Sequence list(pW);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            PyObject* item = (*it).ptr();
+            if (!PyObject_TypeCheck(item, &(Part::TopoShapeEdgePy::Type))) {
+                PyErr_SetString(PyExc_TypeError, "Sequence of edges expected");
+                return nullptr;
+            }
+            const TopoDS_Shape& sh =
+                static_cast<Part::TopoShapeEdgePy*>(item)->getTopoShapePtr()->getShape();
+            if (sh.IsNull()) {
+                PyErr_SetString(PyExc_ValueError, "Edge is empty");
+                return nullptr;
+            }
+            edges.push_back(TopoDS::Edge(sh));
+        }
+
+        Py::List ret;
+        std::vector<std::set<int>> resultSets = getFemMeshPtr()->getNodesByEdges(edges);
+        for (const auto& resultSet : resultSets) {
+            Py::List nodes;
+            for (int it : resultSet) {
+                nodes.append(Py::Long(it));
+            }
+            ret.append(nodes);
+        }
+
+        return Py::new_reference_to(ret);
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+    catch (Standard_Failure& e) {
+        PyErr_SetString(Base::PyExc_FC_CADKernelError, e.GetMessageString());
+        return nullptr;
+    }
+}
+
 PyObject* FemMeshPy::getNodesByVertex(PyObject* args)
 {
     PyObject* pW;
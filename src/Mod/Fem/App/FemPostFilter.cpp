@@ -29,6 +29,9 @@
 #endif
 
 #include <App/Document.h>
+#include <App/GroupExtension.h>
+#include <Base/Console.h>
+#include <Base/TimeInfo.h>
 
 #include "FemPostFilter.h"
 #include "FemPostPipeline.h"
@@ -73,21 +76,96 @@ DocumentObjectExecReturn* FemPostFilter::execute()
             return StdReturn;
         }
 
+        Base::TimeInfo start;
         if ((m_activePipeline == "DataAlongLine") || (m_activePipeline == "DataAtPoint")) {
             pipe.filterSource->SetSourceData(getInputData());
             pipe.filterTarget->Update();
-            Data.setValue(pipe.filterTarget->GetOutputDataObject(0));
+            Data.shareValue(pipe.filterTarget->GetOutputDataObject(0));
         }
         else {
-            pipe.source->SetInputDataObject(data);
+            // Hidden filters are only evaluated once they get visible or
+            // another object links to their output. Free the old result meanwhile.
+            if (!m_dataRequested && !isOutputRequired()) {
+                m_dataOutdated = true;
+                if (Data.getValue()) {
+                    Data.setValue(nullptr);
+                }
+                return StdReturn;
+            }
+            pipe.source->SetInputDataObject(prepareInputData(data));
             pipe.target->Update();
-            Data.setValue(pipe.target->GetOutputDataObject(0));
+            Data.shareValue(pipe.target->GetOutputDataObject(0));
         }
+        m_dataOutdated = false;
+        m_executionTime = Base::TimeInfo::diffTimeF(start);
+        Base::Console().Log("%s: filter took %.3f s\n", getFullName().c_str(), m_executionTime);
     }
 
     return StdReturn;
 }
 
+void FemPostFilter::onChanged(const Property* prop)
+{
+    if (!isRestoring()) {
+        // a deferred filter is evaluated as soon as it gets visible, during a
+        // document recompute it is left to the next one
+        if (prop == &Visibility && Visibility.getValue() && (m_dataOutdated || !Data.getValue())) {
+            if (getDocument() && !getDocument()->testStatus(App::Document::Recomputing)) {
+                m_dataOutdated = true;
+                updateOutdatedData();
+            }
+            else {
+                touch();
+            }
+        }
+        else if (prop == &Input) {
+            auto input = dynamic_cast<FemPostObject*>(Input.getValue());
+            if (input && input->isDataOutdated()) {
+                input->touch();
+            }
+        }
+    }
+    Fem::FemPostObject::onChanged(prop);
+}
+
+void FemPostFilter::updateOutdatedData()
+{
+    if (m_dataOutdated) {
+        m_dataRequested = true;
+        recomputeFeature();
+        m_dataRequested = false;
+    }
+}
+
+void FemPostFilter::beforeSave() const
+{
+    // the document stores the data of hidden filters as well
+    const_cast<FemPostFilter*>(this)->updateOutdatedData();
+    FemPostObject::beforeSave();
+}
+
+vtkSmartPointer<vtkDataObject> FemPostFilter::prepareInputData(vtkDataObject* data)
+{
+    return data;
+}
+
+bool FemPostFilter::isOutputRequired() const
+{
+    if (Visibility.getValue()) {
+        return true;
+    }
+    // any object that links to the filter may read its data, except for the
+    // pipeline and the groups that merely hold it
+    for (auto obj : getInList()) {
+        if (obj->isDerivedFrom<FemPostPipeline>()
+            || obj->hasExtension(App::GroupExtension::getExtensionClassTypeId())) {
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
 vtkDataObject* FemPostFilter::getInputData()
 {
     if (Input.getValue()) {
@@ -657,21 +735,68 @@ DocumentObjectExecReturn* FemPostContoursFilter::execute()
     }
 
     // recalculate the filter
-    auto returnObject = Fem::FemPostFilter::execute();
+    return Fem::FemPostFilter::execute();
+}
 
-    // delete contour field
-    vtkSmartPointer<vtkDataObject> data = getInputData();
+int FemPostContoursFilter::getVectorComponent() const
+{
+    // VectorMode lists "Magnitude", "X", "Y", "Z" for vector fields
+    switch (VectorMode.getValue()) {
+        case 1:
+            return 0;
+        case 2:
+            return 1;
+        case 3:
+            return 2;
+        default:
+            return -1;
+    }
+}
+
+vtkSmartPointer<vtkDataObject> FemPostContoursFilter::prepareInputData(vtkDataObject* data)
+{
     vtkDataSet* dset = vtkDataSet::SafeDownCast(data);
-    if (!dset) {
-        return returnObject;
+    if (!dset || Field.getValue() < 0) {
+        return data;
+    }
+    vtkDataArray* pdata = dset->GetPointData()->GetArray(Field.getValueAsString());
+    if (!pdata || pdata->GetNumberOfComponents() == 1) {
+        return data;
+    }
+
+    // The contour filter handles vectors by taking always its first component.
+    // There is no other solution than to make the desired vectorn component a
+    // scalar array and append this to a copy of the data. (vtkExtractVectorComponents
+    // does not work because our data is an unstructured data set.)
+    int component = getVectorComponent();
+    vtkSmartPointer<vtkDoubleArray> componentArray = vtkSmartPointer<vtkDoubleArray>::New();
+    componentArray->SetNumberOfComponents(1);
+    vtkIdType numTuples = pdata->GetNumberOfTuples();
+    componentArray->SetNumberOfTuples(numTuples);
+
+    if (component >= 0) {
+        for (vtkIdType tupleIdx = 0; tupleIdx < numTuples; ++tupleIdx) {
+            componentArray->SetComponent(tupleIdx, 0, pdata->GetComponent(tupleIdx, component));
+        }
     }
-    dset->GetPointData()->RemoveArray(contourFieldName.c_str());
-    // refresh fields to reflect the deletion
-    if (!m_blockPropertyChanges) {
-        refreshFields();
+    else {
+        int numComponents = pdata->GetNumberOfComponents();
+        for (vtkIdType tupleIdx = 0; tupleIdx < numTuples; ++tupleIdx) {
+            double norm = 0.0;
+            for (int comp = 0; comp < numComponents; ++comp) {
+                double value = pdata->GetComponent(tupleIdx, comp);
+                norm += value * value;
+            }
+            componentArray->SetComponent(tupleIdx, 0, std::sqrt(norm));
+        }
     }
+    componentArray->SetName(contourFieldName.c_str());
 
-    return returnObject;
+    // the input data is shared with other objects, so the array is added to a shallow copy
+    vtkSmartPointer<vtkDataSet> copy = vtkSmartPointer<vtkDataSet>::Take(dset->NewInstance());
+    copy->ShallowCopy(dset);
+    copy->GetPointData()->AddArray(componentArray);
+    return copy;
 }
 
 void FemPostContoursFilter::onChanged(const Property* prop)
@@ -712,56 +837,15 @@ void FemPostContoursFilter::onChanged(const Property* prop)
             recalculateContours(p[0], p[1]);
         }
         else {
-            // The contour filter handles vectors by taking always its first component.
-            // There is no other solution than to make the desired vectorn component a
-            // scalar array and append this temporarily to the data. (vtkExtractVectorComponents
-            // does not work because our data is an unstructured data set.)
-            int component = -1;
-            if (VectorMode.getValue() == 1) {
-                component = 0;
-            }
-            else if (VectorMode.getValue() == 2) {
-                component = 1;
-            }
-            else if (VectorMode.getValue() == 3) {
-                component = 2;
-            }
-            // extract the component to a new array
-            vtkSmartPointer<vtkDoubleArray> componentArray = vtkSmartPointer<vtkDoubleArray>::New();
-            componentArray->SetNumberOfComponents(1);
-            vtkIdType numTuples = pdata->GetNumberOfTuples();
-            componentArray->SetNumberOfTuples(numTuples);
-
-            if (component >= 0) {
-                for (vtkIdType tupleIdx = 0; tupleIdx < numTuples; ++tupleIdx) {
-                    componentArray->SetComponent(tupleIdx,
-                                                 0,
-                                                 pdata->GetComponent(tupleIdx, component));
-                }
-            }
-            else {
-                for (vtkIdType tupleIdx = 0; tupleIdx < numTuples; ++tupleIdx) {
-                    componentArray->SetComponent(
-                        tupleIdx,
-                        0,
-                        std::sqrt(
-                            pdata->GetComponent(tupleIdx, 0) * pdata->GetComponent(tupleIdx, 0)
-                            + pdata->GetComponent(tupleIdx, 1) * pdata->GetComponent(tupleIdx, 1)
-                            + pdata->GetComponent(tupleIdx, 2) * pdata->GetComponent(tupleIdx, 2)));
-                }
-            }
-            // name the array
+            // the component array is added to a copy of the input in prepareInputData(),
+            // the range is taken from the field itself (the norm if component is -1)
             contourFieldName = std::string(Field.getValueAsString()) + "_contour";
-            componentArray->SetName(contourFieldName.c_str());
-
-            // add the array as new field and use it for the contour filter
-            dset->GetPointData()->AddArray(componentArray);
             m_contours->SetInputArrayToProcess(0,
                                                0,
                                                0,
                                                vtkDataObject::FIELD_ASSOCIATION_POINTS,
                                                contourFieldName.c_str());
-            componentArray->GetRange(p);
+            pdata->GetRange(p, getVectorComponent());
             recalculateContours(p[0], p[1]);
             if (prop == &Data) {
                 // we must recalculate to pass the new created contours field
@@ -57,9 +57,19 @@ public:
     App::PropertyLink Input;
 
     App::DocumentObjectExecReturn* execute() override;
+    bool isDataOutdated() const override
+    {
+        return m_dataOutdated;
+    }
+    void updateOutdatedData() override;
+    void beforeSave() const override;
 
 protected:
+    void onChanged(const App::Property* prop) override;
     vtkDataObject* getInputData();
+    /// the data the active pipeline is run on. The input data is shared with
+    /// other objects, so a filter that needs to extend it works on a copy.
+    virtual vtkSmartPointer<vtkDataObject> prepareInputData(vtkDataObject* data);
 
     // pipeline handling for derived filter
     struct FilterPipeline
@@ -74,9 +84,15 @@ protected:
     FilterPipeline& getFilterPipeline(std::string name);
 
 private:
+    bool isOutputRequired() const;
+
     // handling of multiple pipelines which can be the filter
     std::map<std::string, FilterPipeline> m_pipelines;
     std::string m_activePipeline;
+    // the filter was not run because it is hidden and nothing uses its output
+    bool m_dataOutdated = false;
+    // set while the data is computed on request although nothing displays it
+    bool m_dataRequested = false;
 };
 
 class FemExport FemPostSmoothFilterExtension: public App::DocumentObjectExtension
@@ -244,6 +260,9 @@ protected:
     App::DocumentObjectExecReturn* execute() override;
     void onChanged(const App::Property* prop) override;
 
+    vtkSmartPointer<vtkDataObject> prepareInputData(vtkDataObject* data) override;
+
+    int getVectorComponent() const;
     void recalculateContours(double min, double max);
     void refreshFields();
     void refreshVectors();
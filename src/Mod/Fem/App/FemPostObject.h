@@ -49,6 +49,23 @@ public:
 
     vtkBoundingBox getBoundingBox();
     void writeVTK(const char* filename) const;
+
+    /// true if the computation of Data was deferred and it is out of date
+    virtual bool isDataOutdated() const
+    {
+        return false;
+    }
+    /// compute Data now if its computation was deferred
+    virtual void updateOutdatedData()
+    {}
+    /// time in seconds spent on computing Data in the last recompute
+    double getExecutionTime() const
+    {
+        return m_executionTime;
+    }
+
+protected:
+    double m_executionTime = 0.0;
 };
 
 }  // namespace Fem
@@ -24,6 +24,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <Python.h>
+#include <cstring>
 #endif
 
 #include "FemPostObjectPy.h"
@@ -50,13 +51,24 @@ PyObject* FemPostObjectPy::writeVTK(PyObject* args)
 
     std::string utf8Name(filename);
     PyMem_Free(filename);
+    // the data of hidden filters may not be computed yet
+    getFemPostObjectPtr()->updateOutdatedData();
     getFemPostObjectPtr()->writeVTK(utf8Name.c_str());
 
     Py_Return;
 }
 
-PyObject* FemPostObjectPy::getCustomAttributes(const char* /*attr*/) const
+Py::Float FemPostObjectPy::getExecutionTime() const
 {
+    return Py::Float(getFemPostObjectPtr()->getExecutionTime());
+}
+
+PyObject* FemPostObjectPy::getCustomAttributes(const char* attr) const
+{
+    // the data of hidden filters may not be computed yet
+    if (std::strcmp(attr, "Data") == 0) {
+        getFemPostObjectPtr()->updateOutdatedData();
+    }
     return nullptr;
 }
 
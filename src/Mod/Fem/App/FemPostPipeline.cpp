@@ -240,7 +240,7 @@ void FemPostPipeline::load(FemResultObject* res)
     // ***************************
     FemVTKTools::exportFreeCADResult(res, grid);
 
-    Data.setValue(grid);
+    Data.shareValue(grid);
 }
 
 PyObject* FemPostPipeline::getPyObject()
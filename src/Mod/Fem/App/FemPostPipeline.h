@@ -81,7 +81,7 @@ private:
         vtkSmartPointer<TReader> reader = vtkSmartPointer<TReader>::New();
         reader->SetFileName(file.c_str());
         reader->Update();
-        Data.setValue(reader->GetOutput());
+        Data.shareValue(reader->GetOutput());
     }
 };
 
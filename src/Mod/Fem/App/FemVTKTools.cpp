@@ -25,11 +25,13 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
 #include <charconv>
 #include <cmath>
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -1121,26 +1123,51 @@ size_t getFirstNotBlankPos(const std::string_view& view)
     return pos;
 }
 
-// get n-digits value from string_view
-// not used until libc++ std::from_chars supports double values
-// template<typename T>
-// void valueFromLine(const std::string_view::const_iterator& it, int digits, T& value)
-//{
-//    std::string_view sub(it, digits);
-//    auto pos = getFirstNotBlankPos(sub);
-//    std::from_chars(sub.data() + pos, sub.data() + digits, value, 10);
-//}
+// get the fixed-width field at pos of a line
+// the field is shorter or empty if the line ends before
+std::string_view fieldFromLine(std::string_view view,
+                               size_t pos,
+                               size_t digits = std::string_view::npos)
+{
+    if (pos >= view.size()) {
+        return {};
+    }
+    return view.substr(pos, digits);
+}
+
+// get value of a fixed-width field, an empty field gives zero
+// std::from_chars is not used until libc++ supports double values
 template<typename T>
-void valueFromLine(const std::string_view::iterator& it, int digits, T& value)
+void valueFromLine(std::string_view field, T& value)
 {
-    std::string_view sub(&*it, digits);
-    value = std::strtol(sub.data(), nullptr, 10);
+    // strtol() needs a terminated string
+    char buffer[32] = {};
+    field.copy(buffer, std::min(field.size(), sizeof(buffer) - 1));
+    value = std::strtol(buffer, nullptr, 10);
 }
 template<>
-void valueFromLine<double>(const std::string_view::iterator& it, int digits, double& value)
+void valueFromLine<double>(std::string_view field, double& value)
 {
-    std::string_view sub(&*it, digits);
-    value = std::strtof(sub.data(), nullptr);
+    char buffer[32] = {};
+    field.copy(buffer, std::min(field.size(), sizeof(buffer) - 1));
+    value = std::strtof(buffer, nullptr);
+}
+
+// call func with the values of consecutive fixed-width fields, at most maxCount times
+// a truncated last field is read as well, reading stops at a blank field
+template<typename T, typename Func>
+void valuesFromLine(std::string_view view, size_t digits, size_t maxCount, Func&& func)
+{
+    for (size_t count = 0; count < maxCount && !view.empty(); ++count) {
+        std::string_view field = view.substr(0, digits);
+        if (field.find_first_not_of(' ') == std::string_view::npos) {
+            break;
+        }
+        T value;
+        valueFromLine(field, value);
+        func(value);
+        view.remove_prefix(field.size());
+    }
 }
 
 // add cell from sorted nodes
@@ -1272,59 +1299,120 @@ std::vector<size_t> identifyScalarEntities(const std::vector<std::vector<int>> e
     return pos;
 }
 
+// frd file might have nodes that are not numbered starting from zero.
+// NodeIndex maps the node numbers to the vtk point ids. The numbers written
+// by CalculiX are dense, so a plain lookup table is used whenever possible.
+class NodeIndex
+{
+public:
+    NodeIndex() = default;
+    explicit NodeIndex(const std::vector<int>& nodes)
+        : count(nodes.size())
+    {
+        if (nodes.empty()) {
+            return;
+        }
+        auto range = std::minmax_element(nodes.begin(), nodes.end());
+        if (*range.first >= 0 && std::size_t(*range.second) <= 4 * nodes.size() + 1024) {
+            dense.assign(*range.second + 1, -1);
+            for (std::size_t i = 0; i < nodes.size(); ++i) {
+                dense[nodes[i]] = int(i);
+            }
+        }
+        else {
+            for (std::size_t i = 0; i < nodes.size(); ++i) {
+                sparse[nodes[i]] = int(i);
+            }
+        }
+    }
+
+    // throws std::out_of_range for unknown nodes, like std::map::at()
+    int at(int node) const
+    {
+        if (dense.empty()) {
+            return sparse.at(node);
+        }
+        if (node < 0 || std::size_t(node) >= dense.size() || dense[node] < 0) {
+            throw std::out_of_range("Unknown node");
+        }
+        return dense[node];
+    }
+
+    std::size_t size() const
+    {
+        return count;
+    }
+
+private:
+    std::size_t count = 0;
+    std::vector<int> dense;
+    std::unordered_map<int, int> sparse;
+};
+
+// Number of records parsed by one task when a block is parsed in parallel
+constexpr std::size_t recordsPerChunk = 4096;
+
 // read nodes and fill vtkPoints object
-std::map<int, int>
+NodeIndex
 readNodes(std::ifstream& ifstr, const std::string& lines, vtkSmartPointer<vtkPoints>& points)
 {
     std::string keyCode = "    2C";
     std::string keyCodeCoord = " -1";
     long numNodes;
     int indicator;
-    int node;
-    long nodeID = 0;
-
-    // frd file might have nodes that are not numbered starting from zero.
-    // Use the map to identify them
-    std::map<int, int> mapNodes;
 
     std::string_view view {lines};
-    std::string_view sub = view.substr(keyCode.length() + 18);
+    size_t pos = keyCode.length() + 18;
+    valueFromLine(fieldFromLine(view, pos, 12), numNodes);
 
-    valueFromLine(sub.begin(), 12, numNodes);
-
-    sub = sub.substr(12 + 37);
-    valueFromLine(sub.begin(), 1, indicator);
+    pos += 12 + 37;
+    valueFromLine(fieldFromLine(view, pos, 1), indicator);
     int digits = getDigits(static_cast<Indicator>(indicator));
 
-    points->SetNumberOfPoints(numNodes);
-
+    // read the whole block first and parse the lines in parallel afterwards
+    // the count of the header is not trusted for the allocation
+    std::vector<std::string> block;
+    block.reserve(std::clamp(numNodes, 0L, long(64 * recordsPerChunk)));
     std::string line;
-    while (nodeID < numNodes && std::getline(ifstr, line)) {
-        std::vector<double> coords;
-        std::string_view view {line};
-        if (view.rfind(keyCodeCoord, 0) == 0) {
-            std::string_view v(line.data() + keyCodeCoord.length(), digits);
-            valueFromLine(v.begin(), digits, node);
-
-            std::string_view vi = view.substr(keyCodeCoord.length() + digits);
-            double value;
-            for (auto it = vi.begin(); it != vi.end(); it += 12) {
-                valueFromLine(it, 12, value);
-                coords.emplace_back(value);
-            }
+    while (long(block.size()) < numNodes && std::getline(ifstr, line)) {
+        if (line.rfind(keyCodeCoord, 0) == 0) {
+            block.emplace_back(std::move(line));
+        }
+    }
+
+    std::vector<int> nodes(block.size());
+    std::vector<double> coords(3 * block.size(), 0.0);
+    long numChunks = long((block.size() + recordsPerChunk - 1) / recordsPerChunk);
+
+#pragma omp parallel for schedule(dynamic)
+    for (long chunk = 0; chunk < numChunks; ++chunk) {
+        std::size_t end = std::min(block.size(), (chunk + 1) * recordsPerChunk);
+        for (std::size_t i = chunk * recordsPerChunk; i < end; ++i) {
+            std::string_view view {block[i]};
+            valueFromLine(fieldFromLine(view, keyCodeCoord.length(), digits), nodes[i]);
+
+            double* xyz = &coords[3 * i];
+            valuesFromLine<double>(fieldFromLine(view, keyCodeCoord.length() + digits),
+                                   12,
+                                   3,
+                                   [&xyz](double value) {
+                                       *xyz++ = value;
+                                   });
         }
+    }
 
-        points->SetPoint(nodeID, coords.data());
-        mapNodes[node] = nodeID++;
+    points->SetNumberOfPoints(vtkIdType(block.size()));
+    for (std::size_t i = 0; i < block.size(); ++i) {
+        points->SetPoint(vtkIdType(i), &coords[3 * i]);
     }
 
-    return mapNodes;
+    return NodeIndex(nodes);
 }
 
 // fill elements and fill cell array
 std::vector<int> readElements(std::ifstream& ifstr,
                               const std::string& lines,
-                              const std::map<int, int>& mapNodes,
+                              const NodeIndex& mapNodes,
                               vtkSmartPointer<vtkCellArray>& cellArray)
 {
     std::string line;
@@ -1343,32 +1431,31 @@ std::vector<int> readElements(std::ifstream& ifstr,
 
     std::string_view view {lines};
 
-    std::string_view sub = view.substr(keyCode.length() + 18);
-    valueFromLine(sub.begin(), 12, numElem);
+    size_t pos = keyCode.length() + 18;
+    valueFromLine(fieldFromLine(view, pos, 12), numElem);
 
-    sub = sub.substr(12 + 37);
-    valueFromLine(sub.begin(), 1, indicator);
+    pos += 12 + 37;
+    valueFromLine(fieldFromLine(view, pos, 1), indicator);
     int digits = getDigits(static_cast<Indicator>(indicator));
     while (elemID < numElem && std::getline(ifstr, line)) {
         std::string_view view {line};
         if (view.rfind(keyCodeType, 0) == 0) {
-            std::string_view v(line.data() + keyCodeType.length());
-            valueFromLine(v.begin(), digits, elem);
-            v = v.substr(digits);
-            std::string_view::iterator it1;
-            std::vector<int>::iterator it2;
-            for (it1 = v.begin(), it2 = info.begin(); it1 != v.end() && it2 != info.end();
-                 it1 += 5, ++it2) {
-                valueFromLine(it1, 5, *it2);
-            }
+            valueFromLine(fieldFromLine(view, keyCodeType.length(), digits), elem);
+            auto it = info.begin();
+            valuesFromLine<int>(fieldFromLine(view, keyCodeType.length() + digits),
+                                5,
+                                info.size(),
+                                [&it](int value) {
+                                    *it++ = value;
+                                });
         }
         if (view.rfind(keyCodeNodes, 0) == 0) {
-            std::string_view vi = view.substr(keyCodeNodes.length());
-            int node;
-            for (auto it = vi.begin(); it != vi.end(); it += digits) {
-                valueFromLine(it, digits, node);
-                topoElem.emplace_back(mapNodes.at(node));
-            }
+            valuesFromLine<int>(fieldFromLine(view, keyCodeNodes.length()),
+                                digits,
+                                std::string_view::npos,
+                                [&](int node) {
+                                    topoElem.emplace_back(mapNodes.at(node));
+                                });
 
             // add cell to cellArray
             if (topoElem.size() == mapCcxTypeNodes[static_cast<ElementType>(info[0])]) {
@@ -1397,30 +1484,30 @@ void readResultInfo(std::ifstream& ifstr, const std::string& lines, FRDResultInf
     std::string keyCode = "  100C";
 
     std::string_view view {lines};
-    std::string_view sub = view.substr(keyCode.length() + 6);
-    valueFromLine(sub.begin(), 12, info.value);
+    size_t pos = keyCode.length() + 6;
+    valueFromLine(fieldFromLine(view, pos, 12), info.value);
 
-    sub = sub.substr(12);
-    valueFromLine(sub.begin(), 12, info.numNodes);
+    pos += 12;
+    valueFromLine(fieldFromLine(view, pos, 12), info.numNodes);
 
-    sub = sub.substr(12 + 20);
+    pos += 12 + 20;
     int anType;
-    valueFromLine(sub.begin(), 2, anType);
+    valueFromLine(fieldFromLine(view, pos, 2), anType);
     info.analysisType = static_cast<AnalysisType>(anType);
 
-    sub = sub.substr(2);
-    valueFromLine(sub.begin(), 5, info.step);
+    pos += 2;
+    valueFromLine(fieldFromLine(view, pos, 5), info.step);
 
-    sub = sub.substr(5 + 10);
+    pos += 5 + 10;
     int ind;
-    valueFromLine(sub.begin(), 2, ind);
+    valueFromLine(fieldFromLine(view, pos, 2), ind);
     info.indicator = static_cast<Indicator>(ind);
 }
 
 // read result from nodal result block and add result array to grid
 void readResults(std::ifstream& ifstr,
                  const std::string& lines,
-                 const std::map<int, int>& mapNodes,
+                 const NodeIndex& mapNodes,
                  const FRDResultInfo& info,
                  vtkSmartPointer<vtkUnstructuredGrid>& grid)
 {
@@ -1433,12 +1520,11 @@ void readResults(std::ifstream& ifstr,
     unsigned int numComps;
     std::getline(ifstr, line);
     std::string_view view = line;
-    std::string_view sub = view.substr(keyDataSet.length() + 2);
-    std::string dataSetName {sub.substr(0, 8)};
+    size_t pos = keyDataSet.length() + 2;
+    std::string dataSetName {fieldFromLine(view, pos, 8)};
     // remove trailing spaces
     dataSetName.erase(dataSetName.find_last_not_of(" ") + 1);
-    sub = sub.substr(8);
-    valueFromLine(sub.begin(), 5, numComps);
+    valueFromLine(fieldFromLine(view, pos + 8, 5), numComps);
 
     // get entity info
     std::string keyEntity = " -5";
@@ -1450,19 +1536,19 @@ void readResults(std::ifstream& ifstr,
     while (countComp < numComps && std::getline(ifstr, line)) {
         std::string_view view {line};
         if (view.rfind(keyEntity, 0) == 0) {
-            sub = view.substr(keyEntity.length() + 2);
-            std::string en {sub.substr(0, 8)};
+            size_t pos = keyEntity.length() + 2;
+            std::string en {fieldFromLine(view, pos, 8)};
             // remove trailing spaces
             en.erase(en.find_last_not_of(" ") + 1);
             std::vector<int> et = {0, 0, 0, 0};
             // fill entityType, ignore MENU: "    1"
-            sub = sub.substr(8 + 5, 4 * 5);
-            std::string_view::iterator it1;
-            std::vector<int>::iterator it2;
-            for (it1 = sub.begin(), it2 = et.begin(); it1 != sub.end() && it2 != et.end();
-                 (it1 += 5), ++it2) {
-                valueFromLine(it1, digits, *it2);
-            }
+            auto it = et.begin();
+            valuesFromLine<int>(fieldFromLine(view, pos + 8 + 5, 4 * 5),
+                                5,
+                                et.size(),
+                                [&it](int value) {
+                                    *it++ = value;
+                                });
 
             if (et[3] == 0) {
                 // ignore predefined entity
@@ -1476,19 +1562,98 @@ void readResults(std::ifstream& ifstr,
     // used components
     numComps = entityNames.size();
 
-    // enter in node values block
-    std::string code1 = " -1";
-    std::string code2 = " -2";
-    int node;
-    double value;
-    std::vector<double> vecValues;
-    std::vector<double> scaValues;
-    std::vector<int> nodes;
-    int countNodes = 0;
-    int countScaPos;
     // result block could have both vector/matrix and scalar components
     // save each scalars entity in his own array
     auto scalarPos = identifyScalarEntities(entityTypes);
+    // for each value of a node record its target: -1 for the vector array, else the scalar array
+    std::vector<int> target(numComps, -1);
+    for (size_t i = 0; i < scalarPos.size(); ++i) {
+        if (scalarPos[i] < target.size()) {
+            target[scalarPos[i]] = int(i);
+        }
+    }
+    int numVecComps = int(numComps - scalarPos.size());
+
+    // enter in node values block
+    // a node record starts with a " -1" line and may be continued by " -2" lines
+    std::string code1 = " -1";
+    std::string code2 = " -2";
+    std::vector<std::string> block;
+    std::vector<size_t> records;
+    while (long(records.size()) < info.numNodes && std::getline(ifstr, line)) {
+        if (line.rfind(code1, 0) == 0) {
+            records.push_back(block.size());
+            block.emplace_back(std::move(line));
+        }
+        else if (line.rfind(code2, 0) == 0) {
+            block.emplace_back(std::move(line));
+        }
+    }
+    // the continuation lines of the last record
+    while (!records.empty()) {
+        std::streampos pos = ifstr.tellg();
+        if (!std::getline(ifstr, line)) {
+            break;
+        }
+        if (line.rfind(code2, 0) != 0) {
+            ifstr.seekg(pos);
+            break;
+        }
+        block.emplace_back(std::move(line));
+    }
+    records.push_back(block.size());
+
+    size_t numRecords = records.size() - 1;
+    std::vector<int> resultNodes(numRecords, -1);
+    std::vector<double> vecValues(numRecords * numVecComps, 0.0);
+    std::vector<double> scaValues(numRecords * scalarPos.size(), 0.0);
+    std::vector<int> invalidNodes;
+    long numChunks = long((numRecords + recordsPerChunk - 1) / recordsPerChunk);
+
+#pragma omp parallel for schedule(dynamic)
+    for (long chunk = 0; chunk < numChunks; ++chunk) {
+        size_t end = std::min(numRecords, (chunk + 1) * recordsPerChunk);
+        for (size_t rec = chunk * recordsPerChunk; rec < end; ++rec) {
+            int node;
+            std::string_view first {block[records[rec]]};
+            valueFromLine(fieldFromLine(first, code1.length(), digits), node);
+            try {
+                // result nodes could not exist in .frd file due to element expansion
+                // so mapNodes.at() could throw an exception
+                mapNodes.at(node);
+            }
+            catch (const std::out_of_range&) {
+#pragma omp critical
+                invalidNodes.push_back(node);
+                continue;
+            }
+
+            size_t countVec = 0;
+            size_t countSca = 0;
+            size_t countScaPos = 0;
+            for (size_t l = records[rec]; l < records[rec + 1]; ++l) {
+                std::string_view values = fieldFromLine(block[l], code1.length() + digits);
+                valuesFromLine<double>(values, 12, numComps - countScaPos, [&](double value) {
+                    // search if value is scalar or vector/matrix component
+                    if (target[countScaPos++] < 0) {
+                        vecValues[rec * numVecComps + countVec++] = value;
+                    }
+                    else {
+                        scaValues[rec * scalarPos.size() + countSca++] = value;
+                    }
+                });
+            }
+            if (countVec + countSca == numComps) {
+                resultNodes[rec] = node;
+            }
+        }
+    }
+
+    std::sort(invalidNodes.begin(), invalidNodes.end());
+    for (int node : invalidNodes) {
+        Base::Console().Warning("Invalid node: %d\n", node);
+    }
+
     // array for vector entities (if needed)
     vtkSmartPointer<vtkDoubleArray> vecArray = vtkSmartPointer<vtkDoubleArray>::New();
     // arrays for scalar entities (if needed)
@@ -1497,83 +1662,33 @@ void readResults(std::ifstream& ifstr,
         scaArrays.emplace_back(vtkSmartPointer<vtkDoubleArray>::New());
     }
 
-    vecArray->SetNumberOfComponents(numComps - scalarPos.size());
+    vecArray->SetNumberOfComponents(numVecComps);
     vecArray->SetNumberOfTuples(mapNodes.size());
     vecArray->SetName(dataSetName.c_str());
     // set all values to zero
     for (int i = 0; i < vecArray->GetNumberOfComponents(); ++i) {
         vecArray->FillComponent(i, 0.0);
     }
-    //    vecArray->Fill(0.0);
     for (size_t i = 0; i < scaArrays.size(); ++i) {
         scaArrays[i]->SetNumberOfComponents(1);
         scaArrays[i]->SetNumberOfTuples(mapNodes.size());
         std::string name = entityNames[scalarPos[i]];
         scaArrays[i]->SetName(name.c_str());
-        //        scaArrays[i]->Fill(0.0);
         for (int j = 0; j < scaArrays[i]->GetNumberOfComponents(); ++j) {
             scaArrays[i]->FillComponent(j, 0.0);
         }
     }
 
-    while (countNodes < info.numNodes && std::getline(ifstr, line)) {
-        std::string_view view {line};
-        if (view.rfind(code1, 0) == 0) {
-            sub = view.substr(code1.length());
-            valueFromLine(sub.begin(), digits, node);
-            // clear values vector for each node result block
-            vecValues.clear();
-            scaValues.clear();
-            countScaPos = 0;
-            try {
-                // result nodes could not exist in .frd file due to element expansion
-                // so mapNodes.at() could throw an exception
-                nodes.emplace_back(mapNodes.at(node));
-                sub = sub.substr(digits);
-                for (auto it = sub.begin(); it != sub.end(); it += 12, ++countScaPos) {
-                    valueFromLine(it, 12, value);
-                    // search if value is scalar or vector/matrix component
-                    auto pos = std::find(scalarPos.begin(), scalarPos.end(), countScaPos);
-                    if (pos == scalarPos.end()) {
-                        vecValues.emplace_back(value);
-                    }
-                    else {
-                        scaValues.emplace_back(value);
-                    }
-                }
-            }
-            catch (const std::out_of_range& ex) {
-                Base::Console().Warning("Invalid node: %d\n", node);
-            }
-            ++countNodes;
-        }
-        else if (view.rfind(code2, 0) == 0) {
-            sub = view.substr(code2.length() + digits);
-            for (auto it = sub.begin(); it != sub.end(); it += 12) {
-                valueFromLine(it, 12, value);
-                // search if value is scalar or vector/matrix component
-                auto pos = std::find(scalarPos.begin(), scalarPos.end(), countScaPos);
-                if (pos == scalarPos.end()) {
-                    vecValues.emplace_back(value);
-                }
-                else {
-                    scaValues.emplace_back(value);
-                }
-            }
+    for (size_t rec = 0; rec < numRecords; ++rec) {
+        if (resultNodes[rec] < 0) {
+            continue;
         }
-        if ((vecValues.size() + scaValues.size()) == numComps) {
-            if (!vecValues.empty()) {
-                vecArray->SetTuple(mapNodes.at(node), vecValues.data());
-            }
-            if (!scaValues.empty()) {
-                std::vector<vtkSmartPointer<vtkDoubleArray>>::iterator it1;
-                std::vector<double>::iterator it2;
-                for (it1 = scaArrays.begin(), it2 = scaValues.begin();
-                     it1 != scaArrays.end() && it2 != scaValues.end();
-                     ++it1, ++it2) {
-                    (*it1)->SetTuple1(mapNodes.at(node), *it2);
-                }
-            }
+        int id = mapNodes.at(resultNodes[rec]);
+        if (numVecComps > 0) {
+            vecArray->SetTuple(id, &vecValues[rec * numVecComps]);
+        }
+        for (size_t i = 0; i < scaArrays.size(); ++i) {
+            scaArrays[i]->SetTuple1(id, scaValues[rec * scalarPos.size() + i]);
         }
     }
 
@@ -1615,7 +1730,7 @@ vtkSmartPointer<vtkMultiBlockDataSet> readFRD(std::ifstream& ifstr)
     std::map<FRDResultInfo, vtkSmartPointer<vtkUnstructuredGrid>> grids;
     std::map<AnalysisType, vtkSmartPointer<vtkMultiBlockDataSet>> blocks;
     std::string line;
-    std::map<int, int> mapNodes;
+    NodeIndex mapNodes;
     std::vector<int> cellTypes;
 
     while (std::getline(ifstr, line)) {
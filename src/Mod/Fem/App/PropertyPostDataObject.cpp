@@ -103,6 +103,10 @@ void PropertyPostDataObject::scale(double s)
 {
     if (m_dataObject) {
         aboutToSetValue();
+        // the points may be shared with other data objects, so scale a copy
+        vtkSmartPointer<vtkDataObject> shared = m_dataObject;
+        createDataObjectByExternalType(shared);
+        m_dataObject->DeepCopy(shared);
         scaleDataObject(m_dataObject, s);
         hasSetValue();
     }
@@ -123,6 +127,21 @@ void PropertyPostDataObject::setValue(const vtkSmartPointer<vtkDataObject>& ds)
     hasSetValue();
 }
 
+void PropertyPostDataObject::shareValue(const vtkSmartPointer<vtkDataObject>& ds)
+{
+    aboutToSetValue();
+
+    if (ds) {
+        createDataObjectByExternalType(ds);
+        m_dataObject->ShallowCopy(ds);
+    }
+    else {
+        m_dataObject = nullptr;
+    }
+
+    hasSetValue();
+}
+
 const vtkSmartPointer<vtkDataObject>& PropertyPostDataObject::getValue() const
 {
     return m_dataObject;
@@ -165,8 +184,10 @@ App::Property* PropertyPostDataObject::Copy() const
     PropertyPostDataObject* prop = new PropertyPostDataObject();
     if (m_dataObject) {
 
+        // data objects are never modified in place, see scale(), so the
+        // copy can share the data arrays
         prop->createDataObjectByExternalType(m_dataObject);
-        prop->m_dataObject->DeepCopy(m_dataObject);
+        prop->m_dataObject->ShallowCopy(m_dataObject);
     }
 
     return prop;
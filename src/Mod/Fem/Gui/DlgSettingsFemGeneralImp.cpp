@@ -92,6 +92,7 @@ void DlgSettingsFemGeneralImp::saveSettings()
     ui->le_wd_custom->onSave();
     ui->cb_overwrite_solver_working_directory->onSave();
     ui->cmb_def_solver->onSave();
+    ui->cb_binary_mesh_format->onSave();
 }
 
 void DlgSettingsFemGeneralImp::loadSettings()
@@ -108,6 +109,7 @@ void DlgSettingsFemGeneralImp::loadSettings()
     ui->le_wd_custom->onRestore();
     ui->cb_overwrite_solver_working_directory->onRestore();
     ui->cmb_def_solver->onRestore();
+    ui->cb_binary_mesh_format->onRestore();
 }
 
 /**
@@ -96,6 +96,8 @@ def get_femnodes_by_references(femmesh, references):
 
 def get_femnodes_by_refshape(femmesh, ref):
     nodes = []
+    edges = []
+    faces = []
     for refelement in ref[1]:
         r = sub_shape_at_global_placement(ref[0], refelement)
         FreeCAD.Console.PrintMessage(
@@ -108,9 +110,9 @@ def get_femnodes_by_refshape(femmesh, ref):
         if r.ShapeType == "Vertex":
             nodes += femmesh.getNodesByVertex(r)
         elif r.ShapeType == "Edge":
-            nodes += femmesh.getNodesByEdge(r)
+            edges.append(r)
         elif r.ShapeType == "Face":
-            nodes += femmesh.getNodesByFace(r)
+            faces.append(r)
         elif r.ShapeType == "Solid":
             nodes += femmesh.getNodesBySolid(r)
         elif r.ShapeType == "Compound":
@@ -118,6 +120,13 @@ def get_femnodes_by_refshape(femmesh, ref):
                 nodes += femmesh.getNodesBySolid(s)
         else:
             FreeCAD.Console.PrintMessage("  No Vertice, Edge, Face or Solid as reference shapes!\n")
+    # the batch functions build the node index of the mesh only once for all edges or faces
+    if edges:
+        for edge_nodes in femmesh.getNodesByEdges(edges):
+            nodes += edge_nodes
+    if faces:
+        for face_nodes in femmesh.getNodesByFaces(faces):
+            nodes += face_nodes
     return nodes
 
 
@@ -489,11 +498,13 @@ def get_femelement_direction1D_set(femmesh, femelement_table, beamrotation_objec
 def get_femelement_directions_theshape(femmesh, femelement_table, theshape):
     # see get_femelement_direction1D_set
     rotations_ids = []
+    edges = theshape.Shape.Edges
+    # femnodes for all edges, the node index of the mesh is only built once
+    edges_femnodes = femmesh.getNodesByEdges(edges)
     # add directions and all ids for each direction
-    for e in theshape.Shape.Edges:
+    for e, edge_femnodes in zip(edges, edges_femnodes):
         the_edge = {}
         the_edge["direction"] = e.Vertexes[1].Point - e.Vertexes[0].Point
-        edge_femnodes = femmesh.getNodesByEdge(e)  # femnodes for the current edge
         # femelements for this edge
         the_edge["ids"] = get_femelements_by_femnodes_std(femelement_table, edge_femnodes)
         for rot in rotations_ids:
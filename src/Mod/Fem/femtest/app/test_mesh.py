@@ -156,6 +156,144 @@ class TestMeshCommon(unittest.TestCase):
             "Nodes order of quadratic volume element is unexpected",
         )
 
+    # ********************************************************************************************
+    def save_restore_mesh(self, mesh, binary, file_name):
+        # saves the mesh in a document and returns the restored mesh and the document file
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Fem/General")
+        old_binary = param.GetBool("BinaryMeshFormat", False)
+        param.SetBool("BinaryMeshFormat", binary)
+        try:
+            mesh_object = self.document.addObject("Fem::FemMeshObject", "Mesh")
+            mesh_object.FemMesh = mesh
+            fcstd_file = join(
+                testtools.get_fem_test_tmp_dir("mesh_common_document_save"), file_name
+            )
+            self.document.saveAs(fcstd_file)
+        finally:
+            param.SetBool("BinaryMeshFormat", old_binary)
+        FreeCAD.closeDocument(self.document.Name)
+        self.document = FreeCAD.openDocument(fcstd_file)
+        return self.document.getObject("Mesh").FemMesh, fcstd_file
+
+    # ********************************************************************************************
+    def get_mesh_file_names(self, fcstd_file):
+        import zipfile
+
+        with zipfile.ZipFile(fcstd_file) as archive:
+            return [name for name in archive.namelist() if name.startswith("FemMesh")]
+
+    # ********************************************************************************************
+    def test_document_save_restore(self):
+        # with the binary format enabled the mesh is stored as FemMesh.bin inside the
+        # document, see FemMesh::SaveDocFile()
+        mesh = Fem.FemMesh()
+        for i in range(1, 21):
+            mesh.addNode(i, i * i, 0.5 * i, i)
+
+        mesh.addEdge([1, 2], 1)  # seg2
+        mesh.addEdge([1, 3, 2], 2)  # seg3
+        mesh.addFace([1, 2, 3], 11)  # tria3
+        mesh.addFace([1, 2, 3, 4], 12)  # quad4
+        mesh.addFace([1, 2, 3, 4, 5, 6], 13)  # tria6
+        mesh.addFace([1, 2, 3, 4, 5, 6, 7, 8], 14)  # quad8
+        mesh.addPolygon([1, 2, 3, 4, 5], False, 15)
+        mesh.addPolygon([1, 2, 3, 4, 5, 6, 7, 8, 9, 10], True, 16)
+        mesh.addVolume([1, 2, 3, 4], 21)  # tetra4
+        mesh.addVolume([1, 2, 3, 4, 5], 22)  # pyra5
+        mesh.addVolume([1, 2, 3, 4, 5, 6], 23)  # penta6
+        mesh.addVolume(list(range(1, 9)), 24)  # hexa8
+        mesh.addVolume(list(range(1, 11)), 25)  # tetra10
+        mesh.addVolume(list(range(1, 14)), 26)  # pyra13
+        mesh.addVolume(list(range(1, 16)), 27)  # penta15
+        mesh.addVolume(list(range(1, 21)), 28)  # hexa20
+        mesh.addPolyhedron([1, 2, 3, 1, 2, 4, 2, 3, 4, 3, 1, 4], [3, 3, 3, 3], 29)
+
+        node_group = mesh.addGroup("MyNodeGroup", "Node")
+        mesh.addGroupElements(node_group, [1, 5, 9])
+        face_group = mesh.addGroup("MyFaceGroup", "Face")
+        mesh.addGroupElements(face_group, [11, 15, 16])
+
+        restored, fcstd_file = self.save_restore_mesh(mesh, True, "femmesh.FCStd")
+
+        self.assertEqual(self.get_mesh_file_names(fcstd_file), ["FemMesh.bin"])
+        self.assertEqual(restored.Nodes, mesh.Nodes, "Restored nodes are unexpected")
+        elements = mesh.Edges + mesh.Faces + mesh.Volumes
+        self.assertEqual(
+            restored.Edges + restored.Faces + restored.Volumes,
+            elements,
+            "Restored element ids are unexpected",
+        )
+        for elem in elements:
+            self.assertEqual(
+                restored.getElementNodes(elem),
+                mesh.getElementNodes(elem),
+                "Restored nodes of element {} are unexpected".format(elem),
+            )
+            self.assertEqual(
+                restored.getElementType(elem),
+                mesh.getElementType(elem),
+                "Restored type of element {} is unexpected".format(elem),
+            )
+        self.assertEqual(restored.PolygonCount, 2, "Restored polygon count is unexpected")
+        self.assertEqual(restored.PolyhedronCount, 1, "Restored polyhedron count is unexpected")
+        # the dump counts linear and quadratic elements separately
+        self.assertEqual(repr(restored), repr(mesh), "Restored element orders are unexpected")
+        self.assertEqual(
+            [(restored.getGroupName(g), restored.getGroupElements(g)) for g in restored.Groups],
+            [(mesh.getGroupName(g), mesh.getGroupElements(g)) for g in mesh.Groups],
+            "Restored groups are unexpected",
+        )
+
+    # ********************************************************************************************
+    def test_document_save_restore_unv(self):
+        # by default the mesh is stored as FemMesh.unv, which older versions can read
+        mesh = Fem.FemMesh()
+        for i in range(1, 5):
+            mesh.addNode(i, i * i, 0.5 * i, i)
+        mesh.addVolume([1, 2, 3, 4], 1)
+
+        restored, fcstd_file = self.save_restore_mesh(mesh, False, "femmesh_unv.FCStd")
+
+        self.assertEqual(self.get_mesh_file_names(fcstd_file), ["FemMesh.unv"])
+        self.assertEqual(restored.Nodes, mesh.Nodes)
+        self.assertEqual(restored.Volumes, mesh.Volumes)
+
+    # ********************************************************************************************
+    def test_document_restore_corrupt_binary(self):
+        # corrupt counts must not crash the reader, the mesh is restored as far as possible
+        import struct
+        import zipfile
+
+        mesh = Fem.FemMesh()
+        for i in range(1, 5):
+            mesh.addNode(i, i * i, 0.5 * i, i)
+        mesh.addVolume([1, 2, 3, 4], 1)
+        _, fcstd_file = self.save_restore_mesh(mesh, True, "femmesh_corrupt.FCStd")
+        FreeCAD.closeDocument(self.document.Name)
+
+        with zipfile.ZipFile(fcstd_file) as archive:
+            files = {name: archive.read(name) for name in archive.namelist()}
+        data = files["FemMesh.bin"]
+        # version, then the number of nodes
+        huge_count = data[:4] + struct.pack("<I", 0xFFFFFFF0) + data[8:]
+        variants = {
+            "truncated": data[: len(data) // 2],
+            "huge node count": huge_count,
+            "empty": b"",
+        }
+        for name, content in variants.items():
+            corrupt_file = fcstd_file.replace(".FCStd", "_{}.FCStd".format(name.replace(" ", "_")))
+            with zipfile.ZipFile(corrupt_file, "w", zipfile.ZIP_DEFLATED) as archive:
+                for file_name, file_data in files.items():
+                    archive.writestr(
+                        file_name, content if file_name == "FemMesh.bin" else file_data
+                    )
+            self.document = FreeCAD.openDocument(corrupt_file)
+            restored = self.document.getObject("Mesh").FemMesh
+            self.assertLessEqual(restored.NodeCount, mesh.NodeCount, name)
+            FreeCAD.closeDocument(self.document.Name)
+        self.document = FreeCAD.newDocument(self.__class__.__name__)
+
     # ********************************************************************************************
     def test_writeAbaqus_precision(self):
         # https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
@@ -192,6 +330,47 @@ class TestMeshCommon(unittest.TestCase):
             f"Problem in test_writeAbaqus_precision, \n{read_node_line}\n{expected}",
         )
 
+    # ********************************************************************************************
+    def test_nodes_by_shape(self):
+        # the lateral face of a cylinder sector wider than 180 degrees, nodes close to
+        # its ends must not be rejected by a projection onto the wrong side of the axis
+        import math
+        import Part
+
+        radius = 10.0
+        shape = Part.makeCylinder(
+            radius, 5.0, FreeCAD.Vector(0, 0, 0), FreeCAD.Vector(0, 0, 1), 270
+        )
+        face = [f for f in shape.Faces if f.Surface.TypeId == "Part::GeomCylinder"][0]
+
+        def on_circle(angle, r, z):
+            a = math.radians(angle)
+            return (r * math.cos(a), r * math.sin(a), z)
+
+        fm = Fem.FemMesh()
+        fm.addNode(*on_circle(2, radius, 2.5), 1)
+        fm.addNode(*on_circle(268, radius, 2.5), 2)
+        fm.addNode(*on_circle(135, radius, 0.0), 3)
+        fm.addNode(*on_circle(0, radius, 1.0), 4)
+        # on the cylinder, but outside of the sector
+        fm.addNode(*on_circle(315, radius, 2.5), 5)
+        # inside of the sector, but off the surface
+        fm.addNode(*on_circle(90, 12.0, 2.5), 6)
+        fm.addNode(*on_circle(180, 0.0, 2.5), 7)
+
+        self.assertEqual(sorted(fm.getNodesByFace(face)), [1, 2, 3, 4])
+
+        # the batch functions give the same result as one call per shape
+        self.assertEqual(
+            [sorted(nodes) for nodes in fm.getNodesByFaces(shape.Faces)],
+            [sorted(fm.getNodesByFace(f)) for f in shape.Faces],
+        )
+        self.assertEqual(
+            [sorted(nodes) for nodes in fm.getNodesByEdges(shape.Edges)],
+            [sorted(fm.getNodesByEdge(e)) for e in shape.Edges],
+        )
+        self.assertEqual(fm.getNodesByFaces([]), [])
+
 
 # ************************************************************************************************
 # ************************************************************************************************
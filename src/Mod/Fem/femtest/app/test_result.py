@@ -25,10 +25,12 @@ __title__ = "Results FEM unit tests"
 __author__ = "Bernd Hahnebach"
 __url__ = "https://www.freecad.org"
 
+import os
 import unittest
 from os.path import join
 
 import FreeCAD
+import Fem
 
 from . import support_utils as testtools
 from .support_utils import fcc_print
@@ -191,3 +193,48 @@ class TestResult(unittest.TestCase):
         self.assertEqual(
             disp_abs, expected_dispabs, "Calculated displacement abs are not the expected values."
         )
+
+    # ********************************************************************************************
+    def convert_frd(self, lines, base_name):
+        frd_file = join(testtools.get_fem_test_tmp_dir("result_frd"), base_name + ".frd")
+        with open(frd_file, "w") as f:
+            f.write("\n".join(lines) + "\n")
+        Fem.frdToVTK(frd_file)
+        return join(os.path.dirname(frd_file), base_name + "Static.vtm")
+
+    # ********************************************************************************************
+    def get_frd_lines(self):
+        frd_file = join(testtools.get_fem_test_home_dir(), "calculix", "box_static.frd")
+        with open(frd_file) as f:
+            return f.read().splitlines()
+
+    # ********************************************************************************************
+    @unittest.skipUnless(hasattr(Fem, "frdToVTK"), "FEM is built without VTK")
+    def test_frd_to_vtk(self):
+        vtm_file = self.convert_frd(self.get_frd_lines(), "box_static")
+        self.assertTrue(os.path.exists(vtm_file), "No VTK file written from .frd file.")
+
+    # ********************************************************************************************
+    @unittest.skipUnless(hasattr(Fem, "frdToVTK"), "FEM is built without VTK")
+    def test_frd_to_vtk_truncated_lines(self):
+        # node and result records ending inside a field or right after the key code
+        # must not be read beyond the end of the line
+        lines = []
+        block = None
+        for i, line in enumerate(self.get_frd_lines()):
+            if not line.startswith((" -1", " -2")):
+                block = line[:6]
+            elif block != "    3C":
+                line = line[: len(line) - 1 - i % 17]
+            lines.append(line)
+        # a result block with records cut after the key code and the node number
+        lines += [
+            "  100CL  101 1.000000000         280",
+            " -4  DISP        1    1",
+            " -5  D1",
+            " -1",
+            " -1         1",
+            " -2",
+        ]
+        vtm_file = self.convert_frd(lines, "box_static_truncated")
+        self.assertTrue(os.path.exists(vtm_file), "No VTK file written from truncated .frd file.")
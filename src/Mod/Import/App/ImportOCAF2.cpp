@@ -108,8 +108,15 @@ ImportOCAFOptions ImportOCAF2::customImportOptions()
     defaultOptions.reduceObjects = settings.getReduceObjects();
     defaultOptions.showProgress = settings.getShowProgress();
     defaultOptions.expandCompound = settings.getExpandCompound();
+    defaultOptions.tessellate = settings.getTessellateOnImport();
     defaultOptions.mode = static_cast<int>(settings.getImportMode());
 
+    auto hPart =
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part");
+    defaultOptions.meshDeviation = hPart->GetFloat("MeshDeviation", defaultOptions.meshDeviation);
+    defaultOptions.meshAngularDeflection =
+        hPart->GetFloat("MeshAngularDeflection", defaultOptions.meshAngularDeflection);
+
     auto hGrp =
         App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/View");
     defaultOptions.defaultFaceColor.setPackedValue(
@@ -503,6 +510,14 @@ bool ImportOCAF2::createGroup(App::Document* doc,
     return true;
 }
 
+void ImportOCAF2::tessellateShapes()
+{
+    // Mesh the parts with the same parameters the 3D view uses. The view then
+    // finds a fitting triangulation and does not need to mesh the objects one
+    // after the other.
+    Tools::tessellateShapes(aShapeTool, options.meshDeviation, options.meshAngularDeflection);
+}
+
 App::DocumentObject* ImportOCAF2::loadShapes()
 {
     if (!options.useLinkGroup) {
@@ -527,6 +542,10 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     myNames.clear();
     myCollapsedObjects.clear();
 
+    if (options.tessellate) {
+        tessellateShapes();
+    }
+
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes(labels);
     boost::dynamic_bitset<> vis;
@@ -71,6 +71,9 @@ struct ImportExport ImportOCAFOptions
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool tessellate = false;
+    double meshDeviation = 0.2;
+    double meshAngularDeflection = 28.65;
     int mode = 0;
 };
 
@@ -108,6 +111,10 @@ public:
     {
         options.expandCompound = enable;
     }
+    void setTessellate(bool enable)
+    {
+        options.tessellate = enable;
+    }
 
     enum ImportMode
     {
@@ -167,6 +174,7 @@ private:
     std::string getLabelName(TDF_Label label);
     App::DocumentObject*
     expandShape(App::Document* doc, TDF_Label label, const TopoDS_Shape& shape);
+    void tessellateShapes();
 
     virtual void applyEdgeColors(Part::Feature*, const std::vector<App::Color>&)
     {}
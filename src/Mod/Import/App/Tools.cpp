@@ -23,9 +23,26 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <functional>
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Bnd_Box.hxx>
+#include <OSD_Parallel.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
 #include <TDataStd_Name.hxx>
 #include <TDF_ChildIterator.hxx>
+#include <TDF_LabelMap.hxx>
+#include <TDF_LabelSequence.hxx>
 #include <TDF_Tool.hxx>
+#include <TNaming_Builder.hxx>
+#include <TopExp.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <gp.hxx>
 #endif
 
 #include <boost/algorithm/string.hpp>
@@ -33,6 +50,7 @@
 
 #include "Tools.h"
 #include <Base/Console.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #if OCC_VERSION_HEX >= 0x070500
@@ -143,3 +161,145 @@ void Tools::dumpLabels(TDF_Label label,
         dumpLabels(it.Value(), aShapeTool, aColorTool, depth + 1);
     }
 }
+
+namespace
+{
+
+// Call func for the labels of all parts below the free shapes together with the
+// label of the part they refer to. Each assembly is visited once.
+void forEachPart(Handle(XCAFDoc_ShapeTool) aShapeTool,
+                 const std::function<void(const TDF_Label&, const TDF_Label&)>& func)
+{
+    TDF_LabelMap assemblies;
+    std::function<void(const TDF_Label&)> collect = [&](const TDF_Label& label) {
+        TDF_Label baseLabel = label;
+        if (aShapeTool->IsReference(label)) {
+            aShapeTool->GetReferredShape(label, baseLabel);
+        }
+        if (aShapeTool->IsAssembly(baseLabel)) {
+            if (assemblies.Add(baseLabel)) {
+                TDF_LabelSequence components;
+                aShapeTool->GetComponents(baseLabel, components);
+                for (Standard_Integer i = 1; i <= components.Length(); i++) {
+                    collect(components.Value(i));
+                }
+            }
+        }
+        else {
+            func(label, baseLabel);
+        }
+    };
+    TDF_LabelSequence labels;
+    aShapeTool->GetFreeShapes(labels);
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        collect(labels.Value(i));
+    }
+}
+
+}  // namespace
+
+void Tools::copyShapes(Handle(XCAFDoc_ShapeTool) aShapeTool)
+{
+    TDF_LabelMap parts;
+    forEachPart(aShapeTool, [&](const TDF_Label&, const TDF_Label& baseLabel) {
+        TopoDS_Shape shape = aShapeTool->GetShape(baseLabel);
+        if (shape.IsNull() || !parts.Add(baseLabel)) {
+            return;
+        }
+        // keep an existing triangulation, it is still valid for the copy
+        BRepBuilderAPI_Copy copy(shape, Standard_True, Standard_True);
+        TDF_LabelSequence subLabels;
+        aShapeTool->GetSubShapes(baseLabel, subLabels);
+        aShapeTool->SetShape(baseLabel, copy.Shape());
+        // the sub-shape labels carry the colors of faces and edges
+        for (Standard_Integer i = 1; i <= subLabels.Length(); i++) {
+            TopoDS_Shape subShape = aShapeTool->GetShape(subLabels.Value(i));
+            try {
+                TopoDS_Shape subCopy = copy.ModifiedShape(subShape);
+                TNaming_Builder builder(subLabels.Value(i));
+                builder.Generated(subCopy);
+            }
+            catch (const Standard_Failure&) {
+                FC_WARN("No copy of sub-shape " << labelName(subLabels.Value(i)));
+            }
+        }
+    });
+}
+
+void Tools::tessellateShapes(Handle(XCAFDoc_ShapeTool) aShapeTool,
+                             double deviation,
+                             double angularDeflection)
+{
+    // Collect the shape of every part once, repeated instances share it. The
+    // object that is created for a part carries the placement of its first
+    // instance and the 3D view computes the deflection from the bounding box
+    // of that located shape. Use the same shape here, otherwise the deflection
+    // differs and the view meshes the part again.
+    std::vector<TopoDS_Shape> shapes;
+    TopTools_MapOfShape parts;
+    forEachPart(aShapeTool, [&](const TDF_Label& label, const TDF_Label&) {
+        TopoDS_Shape shape = aShapeTool->GetShape(label);
+        if (!shape.IsNull() && parts.Add(shape.Located(TopLoc_Location()))) {
+            shapes.push_back(shape);
+        }
+    });
+
+    // The mesh is stored in the faces and edges. Different parts may still
+    // share them, e.g. a compound and the labels of its sub-shapes, so only
+    // the parts that share nothing are meshed in parallel.
+    TopTools_DataMapOfShapeInteger owners;
+    std::vector<char> shared(shapes.size(), 0);
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        for (TopAbs_ShapeEnum type : {TopAbs_FACE, TopAbs_EDGE}) {
+            TopTools_IndexedMapOfShape subShapes;
+            TopExp::MapShapes(shapes[i], type, subShapes);
+            for (Standard_Integer j = 1; j <= subShapes.Extent(); ++j) {
+                TopoDS_Shape subShape = subShapes(j).Located(TopLoc_Location());
+                if (const Standard_Integer* owner = owners.Seek(subShape)) {
+                    if (*owner != static_cast<Standard_Integer>(i)) {
+                        shared[*owner] = 1;
+                        shared[i] = 1;
+                    }
+                }
+                else {
+                    owners.Bind(subShape, static_cast<Standard_Integer>(i));
+                }
+            }
+        }
+    }
+    std::vector<TopoDS_Shape> independent;
+    std::vector<TopoDS_Shape> dependent;
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        (shared[i] ? dependent : independent).push_back(shapes[i]);
+    }
+    FC_LOG("tessellate " << shapes.size() << " shapes, " << dependent.size() << " shared");
+
+    double angle = Base::toRadians<double>(angularDeflection);
+    auto tessellate = [&](const TopoDS_Shape& shape) {
+        Bnd_Box bounds;
+        BRepBndLib::Add(shape, bounds);
+        bounds.SetGap(0.0);
+        if (bounds.IsVoid()) {
+            return;
+        }
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        Standard_Real deflection =
+            ((xMax - xMin) + (yMax - yMin) + (zMax - zMin)) / 300.0 * deviation;
+        if (deflection < gp::Resolution()) {
+            deflection = Precision::Confusion();
+        }
+        try {
+            BRepMesh_IncrementalMesh(shape, deflection, Standard_False, angle, Standard_False);
+        }
+        catch (const Standard_Failure&) {
+            // leave it to the caller
+        }
+    };
+    OSD_Parallel::For(0, static_cast<int>(independent.size()), [&](int i) {
+        tessellate(independent[i]);
+    });
+    for (const auto& shape : dependent) {
+        tessellate(shape);
+    }
+}
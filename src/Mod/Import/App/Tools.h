@@ -72,6 +72,20 @@ struct Tools
                            Handle(XCAFDoc_ShapeTool) aShapeTool,
                            Handle(XCAFDoc_ColorTool) aColorTool,
                            int depth = 0);
+
+    /// Replace the shapes of all non-assembly labels by copies, so that meshing
+    /// them leaves the shapes they were made from alone. The sub-shape labels
+    /// are moved to the copies.
+    static void copyShapes(Handle(XCAFDoc_ShapeTool) aShapeTool);
+
+    /// Mesh the shapes of all non-assembly labels in parallel. Each shape is
+    /// meshed once no matter how often it is instanced. The linear deflection
+    /// is derived from the bounding box of its first instance as the 3D view
+    /// does, \a angularDeflection is in degrees. Shapes sharing faces or edges
+    /// are meshed one after the other.
+    static void tessellateShapes(Handle(XCAFDoc_ShapeTool) aShapeTool,
+                                 double deviation,
+                                 double angularDeflection);
 };
 
 }  // namespace Import
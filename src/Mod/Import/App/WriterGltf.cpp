@@ -27,6 +27,7 @@
 #include <boost/core/ignore_unused.hpp>
 #include <Standard_Version.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
 #if OCC_VERSION_HEX >= 0x070500
 #include <Message_ProgressRange.hxx>
 #include <RWGltf_CafWriter.hxx>
@@ -34,14 +35,22 @@
 #endif
 
 #include "WriterGltf.h"
+#include "Tools.h"
+#include <App/Application.h>
 #include <Base/Exception.h>
+#include <Base/Parameter.h>
 #include <Mod/Part/App/encodeFilename.h>
 
 using namespace Import;
 
 WriterGltf::WriterGltf(const Base::FileInfo& file)  // NOLINT
     : file {file}
-{}
+{
+    auto hPart =
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part");
+    meshDeviation = hPart->GetFloat("MeshDeviation", meshDeviation);
+    meshAngularDeflection = hPart->GetFloat("MeshAngularDeflection", meshAngularDeflection);
+}
 
 void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 {
@@ -49,6 +58,13 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
     std::string name8bit = Part::encodeFilename(utf8Name);
 
 #if OCC_VERSION_HEX >= 0x070500
+    // The writer only exports existing triangulations. Mesh every part once up
+    // front, instances of the same part then share the mesh in the file. The
+    // shapes of the document belong to the exported objects, so mesh copies.
+    Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    Tools::copyShapes(aShapeTool);
+    Tools::tessellateShapes(aShapeTool, meshDeviation, meshAngularDeflection);
+
     TColStd_IndexedDataMapOfStringString aMetadata;
     RWGltf_CafWriter aWriter(name8bit.c_str(), file.hasExtension("glb"));
     aWriter.SetTransformationFormat(RWGltf_WriterTrsfFormat_Compact);
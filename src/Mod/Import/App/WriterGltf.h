@@ -40,6 +40,9 @@ public:
 
 private:
     Base::FileInfo file;
+    // parameters to mesh shapes without triangulation, the angle is in degrees
+    double meshDeviation = 0.2;
+    double meshAngularDeflection = 28.65;
 };
 }  // namespace Import
 
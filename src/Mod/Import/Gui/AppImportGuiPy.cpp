@@ -244,6 +244,10 @@ private:
                         ocaf.setExpandCompound(
                             static_cast<bool>(Py::Boolean(options.getItem("expandCompound"))));
                     }
+                    if (options.hasKey("tessellate")) {
+                        ocaf.setTessellate(
+                            static_cast<bool>(Py::Boolean(options.getItem("tessellate"))));
+                    }
                     if (options.hasKey("mode")) {
                         ocaf.setMode(static_cast<int>(Py::Long(options.getItem("mode"))));
                     }
@@ -45,12 +45,90 @@
 #include "Approximation.h"
 #include "CylinderFit.h"
 #include "Elements.h"
+#include "Functional.h"
 #include "SphereFit.h"
 #include "Utilities.h"
 
 
 using namespace MeshCore;
 
+void PointMoments::Add(const Base::Vector3f& point)
+{
+    double x = point.x;
+    double y = point.y;
+    double z = point.z;
+    count++;
+    sx += x;
+    sy += y;
+    sz += z;
+    sxx += x * x;
+    sxy += x * y;
+    sxz += x * z;
+    syy += y * y;
+    syz += y * z;
+    szz += z * z;
+}
+
+void PointMoments::Add(const Base::Vector3f* points, std::size_t count)
+{
+    // below this size the overhead of starting threads isn't worth it
+    const std::size_t minBlockSize = 100000;
+    auto blocks =
+        parallel_blocks(count, minBlockSize, [points](std::size_t begin, std::size_t end) {
+            // local sums can be kept in registers
+            PointMoments moments;
+            for (std::size_t i = begin; i < end; i++) {
+                moments.Add(points[i]);
+            }
+            return moments;
+        });
+    for (const auto& it : blocks) {
+        *this += it;
+    }
+}
+
+PointMoments& PointMoments::operator+=(const PointMoments& moments)
+{
+    count += moments.count;
+    sx += moments.sx;
+    sy += moments.sy;
+    sz += moments.sz;
+    sxx += moments.sxx;
+    sxy += moments.sxy;
+    sxz += moments.sxz;
+    syy += moments.syy;
+    syz += moments.syz;
+    szz += moments.szz;
+    return *this;
+}
+
+Base::Vector3d PointMoments::Mean() const
+{
+    if (count == 0) {
+        return Base::Vector3d();
+    }
+    double num = double(count);
+    return Base::Vector3d(sx / num, sy / num, sz / num);
+}
+
+void PointMoments::Covariance(double& cxx,
+                              double& cxy,
+                              double& cxz,
+                              double& cyy,
+                              double& cyz,
+                              double& czz) const
+{
+    double num = double(count);
+    cxx = sxx - sx * sx / num;
+    cxy = sxy - sx * sy / num;
+    cxz = sxz - sx * sz / num;
+    cyy = syy - sy * sy / num;
+    cyz = syz - sy * sz / num;
+    czz = szz - sz * sz / num;
+}
+
+// -------------------------------------------------------------------------------
+
 Approximation::Approximation() = default;
 
 Approximation::~Approximation()
@@ -60,53 +138,64 @@ Approximation::~Approximation()
 
 void Approximation::GetMgcVectorArray(std::vector<Wm4::Vector3<double>>& rcPts) const
 {
-    std::list<Base::Vector3f>::const_iterator It;
     rcPts.reserve(_vPoints.size());
-    for (It = _vPoints.begin(); It != _vPoints.end(); ++It) {
-        rcPts.push_back(Base::convertTo<Wm4::Vector3d>(*It));
+    for (const auto& it : _vPoints) {
+        rcPts.push_back(Base::convertTo<Wm4::Vector3d>(it));
     }
 }
 
+void Approximation::UpdateMoments()
+{
+    _moments = PointMoments();
+    _moments.Add(_vPoints.data(), _vPoints.size());
+}
+
 void Approximation::AddPoint(const Base::Vector3f& point)
 {
     _vPoints.push_back(point);
+    _moments.Add(point);
     _bIsFitted = false;
 }
 
 void Approximation::AddPoints(const std::vector<Base::Vector3f>& points)
 {
-    std::copy(points.begin(), points.end(), std::back_inserter(_vPoints));
-    _bIsFitted = false;
+    AddPoints(points.data(), points.size());
 }
 
 void Approximation::AddPoints(const std::set<Base::Vector3f>& points)
 {
-    std::copy(points.begin(), points.end(), std::back_inserter(_vPoints));
+    std::size_t index = _vPoints.size();
+    _vPoints.insert(_vPoints.end(), points.begin(), points.end());
+    _moments.Add(_vPoints.data() + index, points.size());
     _bIsFitted = false;
 }
 
 void Approximation::AddPoints(const std::list<Base::Vector3f>& points)
 {
-    std::copy(points.begin(), points.end(), std::back_inserter(_vPoints));
+    std::size_t index = _vPoints.size();
+    _vPoints.insert(_vPoints.end(), points.begin(), points.end());
+    _moments.Add(_vPoints.data() + index, points.size());
     _bIsFitted = false;
 }
 
 void Approximation::AddPoints(const MeshPointArray& points)
 {
-    std::copy(points.begin(), points.end(), std::back_inserter(_vPoints));
+    std::size_t index = _vPoints.size();
+    _vPoints.insert(_vPoints.end(), points.begin(), points.end());
+    _moments.Add(_vPoints.data() + index, points.size());
+    _bIsFitted = false;
+}
+
+void Approximation::AddPoints(const Base::Vector3f* points, std::size_t count)
+{
+    _vPoints.insert(_vPoints.end(), points, points + count);
+    _moments.Add(points, count);
     _bIsFitted = false;
 }
 
 Base::Vector3f Approximation::GetGravity() const
 {
-    Base::Vector3f clGravity;
-    if (!_vPoints.empty()) {
-        for (const auto& vPoint : _vPoints) {
-            clGravity += vPoint;
-        }
-        clGravity *= 1.0F / float(_vPoints.size());
-    }
-    return clGravity;
+    return Base::convertTo<Base::Vector3f>(_moments.Mean());
 }
 
 std::size_t Approximation::CountPoints() const
@@ -117,6 +206,7 @@ std::size_t Approximation::CountPoints() const
 void Approximation::Clear()
 {
     _vPoints.clear();
+    _moments = PointMoments();
     _bIsFitted = false;
 }
 
@@ -146,35 +236,20 @@ float PlaneFit::Fit()
         return FLOAT_MAX;
     }
 
+    // the sums are kept up to date when adding points, so re-fitting
+    // a growing point set doesn't iterate over all points again
     double sxx {0.0};
     double sxy {0.0};
     double sxz {0.0};
     double syy {0.0};
     double syz {0.0};
     double szz {0.0};
-    double mx {0.0};
-    double my {0.0};
-    double mz {0.0};
-
-    for (const auto& vPoint : _vPoints) {
-        sxx += double(vPoint.x * vPoint.x);
-        sxy += double(vPoint.x * vPoint.y);
-        sxz += double(vPoint.x * vPoint.z);
-        syy += double(vPoint.y * vPoint.y);
-        syz += double(vPoint.y * vPoint.z);
-        szz += double(vPoint.z * vPoint.z);
-        mx += double(vPoint.x);
-        my += double(vPoint.y);
-        mz += double(vPoint.z);
-    }
-
-    size_t nSize = _vPoints.size();
-    sxx = sxx - mx * mx / (double(nSize));
-    sxy = sxy - mx * my / (double(nSize));
-    sxz = sxz - mx * mz / (double(nSize));
-    syy = syy - my * my / (double(nSize));
-    syz = syz - my * mz / (double(nSize));
-    szz = szz - mz * mz / (double(nSize));
+    _moments.Covariance(sxx, sxy, sxz, syy, syz, szz);
+
+    double mx = _moments.sx;
+    double my = _moments.sy;
+    double mz = _moments.sz;
+    size_t nSize = _moments.count;
 
 #if defined(FC_USE_EIGEN)
     Eigen::Matrix3d covMat = Eigen::Matrix3d::Zero();
@@ -338,10 +413,9 @@ float PlaneFit::GetStdDeviation() const
     float fSumXi = 0.0F, fSumXi2 = 0.0F, fMean = 0.0F, fDist = 0.0F;
 
     float ulPtCt = float(CountPoints());
-    std::list<Base::Vector3f>::const_iterator cIt;
 
-    for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
-        fDist = GetDistanceToPlane(*cIt);
+    for (const auto& it : _vPoints) {
+        fDist = GetDistanceToPlane(it);
         fSumXi += fDist;
         fSumXi2 += (fDist * fDist);
     }
@@ -364,19 +438,14 @@ float PlaneFit::GetSignedStdDeviation() const
     float fFactor = 0.0F;
 
     float ulPtCt = float(CountPoints());
-    Base::Vector3f clGravity, clPt;
-    std::list<Base::Vector3f>::const_iterator cIt;
-    for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
-        clGravity += *cIt;
-    }
-    clGravity *= (1.0F / ulPtCt);
+    Base::Vector3f clGravity(GetGravity()), clPt;
 
-    for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
-        if ((clGravity - *cIt).Length() < fMinDist) {
-            fMinDist = (clGravity - *cIt).Length();
-            clPt = *cIt;
+    for (const auto& it : _vPoints) {
+        if ((clGravity - it).Length() < fMinDist) {
+            fMinDist = (clGravity - it).Length();
+            clPt = it;
         }
-        fDist = GetDistanceToPlane(*cIt);
+        fDist = GetDistanceToPlane(it);
         fSumXi += fDist;
         fSumXi2 += (fDist * fDist);
     }
@@ -403,6 +472,7 @@ void PlaneFit::ProjectToPlane()
         float fD = (cPnt - cGravity) * cNormal;
         cPnt = cPnt - fD * cNormal;
     }
+    UpdateMoments();
 }
 
 void PlaneFit::Dimension(float& length, float& width) const
@@ -412,9 +482,8 @@ void PlaneFit::Dimension(float& length, float& width) const
     const Base::Vector3f& ey = _vDirV;
 
     Base::BoundBox3f bbox;
-    std::list<Base::Vector3f>::const_iterator cIt;
-    for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
-        Base::Vector3f pnt = *cIt;
+    for (const auto& it : _vPoints) {
+        Base::Vector3f pnt = it;
         pnt.TransformToCoordinateSystem(bs, ex, ey);
         bbox.Add(pnt);
     }
@@ -1304,10 +1373,9 @@ float CylinderFit::GetStdDeviation() const
     float fSumXi = 0.0F, fSumXi2 = 0.0F, fMean = 0.0F, fDist = 0.0F;
 
     float ulPtCt = float(CountPoints());
-    std::list<Base::Vector3f>::const_iterator cIt;
 
-    for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
-        fDist = GetDistanceToCylinder(*cIt);
+    for (const auto& it : _vPoints) {
+        fDist = GetDistanceToCylinder(it);
         fSumXi += fDist;
         fSumXi2 += (fDist * fDist);
     }
@@ -1321,8 +1389,7 @@ void CylinderFit::GetBounding(Base::Vector3f& bottom, Base::Vector3f& top) const
     float distMin = FLT_MAX;
     float distMax = FLT_MIN;
 
-    std::list<Base::Vector3f>::const_iterator cIt;
-    for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
+    for (auto cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
         float dist = cIt->DistanceToPlane(_vBase, _vAxis);
         if (dist < distMin) {
             distMin = dist;
@@ -1370,6 +1437,7 @@ void CylinderFit::ProjectToCylinder()
             cPnt = proj + diff * _fRadius;
         }
     }
+    UpdateMoments();
 }
 
 // -----------------------------------------------------------------------------
@@ -1475,10 +1543,9 @@ float SphereFit::GetStdDeviation() const
     float fSumXi = 0.0F, fSumXi2 = 0.0F, fMean = 0.0F, fDist = 0.0F;
 
     float ulPtCt = float(CountPoints());
-    std::list<Base::Vector3f>::const_iterator cIt;
 
-    for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
-        fDist = GetDistanceToSphere(*cIt);
+    for (const auto& it : _vPoints) {
+        fDist = GetDistanceToSphere(it);
         fSumXi += fDist;
         fSumXi2 += (fDist * fDist);
     }
@@ -1506,6 +1573,7 @@ void SphereFit::ProjectToSphere()
             cPnt = _vCenter + diff * _fRadius;
         }
     }
+    UpdateMoments();
 }
 
 // -------------------------------------------------------------------------------
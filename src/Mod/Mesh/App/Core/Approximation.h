@@ -116,6 +116,45 @@ namespace MeshCore
 {
 class MeshPointArray;
 
+/**
+ * Sums of the coordinates and of their products over a set of points. The sums can be
+ * updated incrementally, so a fit that only needs the mean and the covariance matrix
+ * (e.g. a plane) doesn't have to iterate over all points again when points are added.
+ */
+class MeshExport PointMoments
+{
+public:
+    /**
+     * Adds a single point.
+     */
+    void Add(const Base::Vector3f& point);
+    /**
+     * Adds \a count points stored contiguously at \a points. Large arrays are split
+     * into blocks that are summed up in parallel.
+     */
+    void Add(const Base::Vector3f* points, std::size_t count);
+    /**
+     * Merges the sums of another point set.
+     */
+    PointMoments& operator+=(const PointMoments& moments);
+    /**
+     * Returns the mean of the added points.
+     */
+    Base::Vector3d Mean() const;
+    /**
+     * Computes the covariance matrix (not divided by the number of points) of the added
+     * points in the order xx, xy, xz, yy, yz, zz.
+     */
+    void Covariance(double& cxx, double& cxy, double& cxz, double& cyy, double& cyz, double& czz)
+        const;
+
+    // NOLINTBEGIN
+    std::size_t count {0};
+    double sx {0.0}, sy {0.0}, sz {0.0};
+    double sxx {0.0}, sxy {0.0}, sxz {0.0}, syy {0.0}, syz {0.0}, szz {0.0};
+    // NOLINTEND
+};
+
 /**
  * Abstract base class for approximation of a geometry to a given set of points.
  */
@@ -150,13 +189,24 @@ public:
      * Add points for the fit algorithm.
      */
     void AddPoints(const MeshPointArray& points);
+    /**
+     * Add \a count points stored contiguously at \a points for the fit algorithm.
+     */
+    void AddPoints(const Base::Vector3f* points, std::size_t count);
     /**
      * Get all added points.
      */
-    const std::list<Base::Vector3f>& GetPoints() const
+    const std::vector<Base::Vector3f>& GetPoints() const
     {
         return _vPoints;
     }
+    /**
+     * Returns the sums of the coordinates of all added points.
+     */
+    const PointMoments& GetMoments() const
+    {
+        return _moments;
+    }
     /**
      * Returns the center of gravity of the current added points.
      * @return Base::Vector3f
@@ -191,6 +241,10 @@ protected:
      * Creates a vector of Wm4::Vector3 elements.
      */
     void GetMgcVectorArray(std::vector<Wm4::Vector3<double>>& rcPts) const;
+    /**
+     * Recomputes the moments after the points have been modified in place.
+     */
+    void UpdateMoments();
 
     Approximation(const Approximation&) = default;
     Approximation(Approximation&&) = default;
@@ -199,9 +253,10 @@ protected:
 
 protected:
     // NOLINTBEGIN
-    std::list<Base::Vector3f> _vPoints; /**< Holds the points for the fit algorithm.  */
-    bool _bIsFitted {false};            /**< Flag, whether the fit has been called. */
-    float _fLastResult {FLOAT_MAX};     /**< Stores the last result of the fit */
+    std::vector<Base::Vector3f> _vPoints; /**< Holds the points for the fit algorithm.  */
+    PointMoments _moments;                /**< Sums over the points for the fit algorithm. */
+    bool _bIsFitted {false};              /**< Flag, whether the fit has been called. */
+    float _fLastResult {FLOAT_MAX};       /**< Stores the last result of the fit */
     // NOLINTEND
 };
 
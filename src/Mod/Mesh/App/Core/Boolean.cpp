@@ -0,0 +1,1400 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association                    *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <numbers>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+#endif
+
+#include "Boolean.h"
+#include "Functional.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+
+using Triangle = std::array<Base::Vector3f, 3>;
+
+// ------------------------------------------------------------------------------------------------
+// Orientation predicate after J. R. Shewchuk, "Adaptive Precision Floating-Point Arithmetic and
+// Fast Robust Geometric Predicates". A floating-point filter decides the sign in the usual case,
+// otherwise the determinant is evaluated exactly as a sum of products of the float coordinates.
+
+void twoSum(double a, double b, double& sum, double& err)
+{
+    sum = a + b;
+    double bv = sum - a;
+    double av = sum - bv;
+    err = (a - av) + (b - bv);
+}
+
+void twoProduct(double a, double b, double& prod, double& err)
+{
+    prod = a * b;
+    err = std::fma(a, b, -prod);
+}
+
+// Non-overlapping sequence of doubles with increasing magnitude whose sum is exact
+class Expansion
+{
+public:
+    void Add(double value)
+    {
+        std::size_t count = 0;
+        double sum = value;
+        for (std::size_t i = 0; i < size; i++) {
+            double err {};
+            twoSum(sum, components[i], sum, err);
+            if (err != 0.0) {
+                components[count++] = err;
+            }
+        }
+        if (sum != 0.0) {
+            components[count++] = sum;
+        }
+        size = count;
+    }
+    void AddProduct(double a, double b, double c)
+    {
+        // a * b is exact because a and b have single precision
+        double prod {};
+        double err {};
+        twoProduct(a * b, c, prod, err);
+        Add(err);
+        Add(prod);
+    }
+    int Sign() const
+    {
+        if (size == 0) {
+            return 0;
+        }
+        return components[size - 1] > 0.0 ? 1 : -1;
+    }
+
+private:
+    std::array<double, 64> components {};
+    std::size_t size = 0;
+};
+
+int orient3dExact(const Base::Vector3f& a,
+                  const Base::Vector3f& b,
+                  const Base::Vector3f& c,
+                  const Base::Vector3f& d)
+{
+    // det(a - d, b - d, c - d) = [a,b,c] - [a,b,d] + [a,c,d] - [b,c,d]
+    Expansion det;
+    auto addTriple = [&det](const Base::Vector3f& p,
+                            const Base::Vector3f& q,
+                            const Base::Vector3f& r,
+                            double sign) {
+        det.AddProduct(sign * p.x, q.y, r.z);
+        det.AddProduct(-sign * p.x, q.z, r.y);
+        det.AddProduct(-sign * p.y, q.x, r.z);
+        det.AddProduct(sign * p.y, q.z, r.x);
+        det.AddProduct(sign * p.z, q.x, r.y);
+        det.AddProduct(-sign * p.z, q.y, r.x);
+    };
+    addTriple(a, b, c, 1.0);
+    addTriple(a, b, d, -1.0);
+    addTriple(a, c, d, 1.0);
+    addTriple(b, c, d, -1.0);
+    return det.Sign();
+}
+
+// Returns the sign of det(a - d, b - d, c - d), i.e. on which side of the plane through a, b, c
+// the point d lies.
+int orient3d(const Base::Vector3f& a,
+             const Base::Vector3f& b,
+             const Base::Vector3f& c,
+             const Base::Vector3f& d)
+{
+    double adx = double(a.x) - d.x;
+    double bdx = double(b.x) - d.x;
+    double cdx = double(c.x) - d.x;
+    double ady = double(a.y) - d.y;
+    double bdy = double(b.y) - d.y;
+    double cdy = double(c.y) - d.y;
+    double adz = double(a.z) - d.z;
+    double bdz = double(b.z) - d.z;
+    double cdz = double(c.z) - d.z;
+
+    double bdxcdy = bdx * cdy;
+    double cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady;
+    double adxcdy = adx * cdy;
+    double adxbdy = adx * bdy;
+    double bdxady = bdx * ady;
+
+    double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+    double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * std::fabs(adz)
+        + (std::fabs(cdxady) + std::fabs(adxcdy)) * std::fabs(bdz)
+        + (std::fabs(adxbdy) + std::fabs(bdxady)) * std::fabs(cdz);
+
+    constexpr double epsilon = std::numeric_limits<double>::epsilon() / 2.0;
+    constexpr double errorBound = (7.0 + 56.0 * epsilon) * epsilon;
+    if (det > errorBound * permanent) {
+        return 1;
+    }
+    if (-det > errorBound * permanent) {
+        return -1;
+    }
+    return orient3dExact(a, b, c, d);
+}
+
+// ------------------------------------------------------------------------------------------------
+
+struct Plane
+{
+    Base::Vector3d normal;
+    double distance {};
+
+    explicit Plane(const Triangle& tria)
+    {
+        Base::Vector3d p0 = Base::toVector<double>(tria[0]);
+        normal = (Base::toVector<double>(tria[1]) - p0) % (Base::toVector<double>(tria[2]) - p0);
+        normal.Normalize();
+        distance = normal * p0;
+    }
+    double Distance(const Base::Vector3d& pnt) const
+    {
+        return normal * pnt - distance;
+    }
+};
+
+Base::BoundBox3f boundBox(const Triangle& tria)
+{
+    Base::BoundBox3f box;
+    for (const auto& it : tria) {
+        box.Add(it);
+    }
+    return box;
+}
+
+// Bounding volume hierarchy of triangles, used to find intersecting facets and to compute the
+// generalized winding number after A. Jacobson et al., "Robust Inside-Outside Segmentation using
+// Generalized Winding Numbers" with the far field approximation of G. Barill et al.,
+// "Fast Winding Numbers for Soups and Clouds".
+class TriangleTree
+{
+public:
+    explicit TriangleTree(const std::vector<Triangle>& triangles)
+        : triangles(triangles)
+    {
+        if (triangles.empty()) {
+            return;
+        }
+        order.resize(triangles.size());
+        std::iota(order.begin(), order.end(), 0);
+        centers.reserve(triangles.size());
+        for (const auto& it : triangles) {
+            Base::Vector3d sum = Base::toVector<double>(it[0]) + Base::toVector<double>(it[1])
+                + Base::toVector<double>(it[2]);
+            centers.push_back(sum / 3.0);
+        }
+        nodes.reserve(2 * triangles.size() / leafSize + 1);
+        Build(0, order.size());
+        centers.clear();
+    }
+
+    template<class Func>
+    void Query(const Base::BoundBox3f& box, Func&& func) const
+    {
+        if (nodes.empty()) {
+            return;
+        }
+        std::vector<std::size_t> stack {0};
+        while (!stack.empty()) {
+            const Node& node = nodes[stack.back()];
+            std::size_t index = stack.back();
+            stack.pop_back();
+            if (!node.box.Intersect(box)) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                    func(order[i]);
+                }
+            }
+            else {
+                stack.push_back(index + 1);
+                stack.push_back(node.right);
+            }
+        }
+    }
+
+    double WindingNumber(const Base::Vector3d& pnt) const
+    {
+        if (nodes.empty()) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        std::vector<std::size_t> stack {0};
+        while (!stack.empty()) {
+            std::size_t index = stack.back();
+            const Node& node = nodes[index];
+            stack.pop_back();
+            Base::Vector3d dir = node.center - pnt;
+            double dist = dir.Length();
+            if (dist > farField * node.radius) {
+                sum += (node.areaNormal * dir) / (dist * dist * dist);
+            }
+            else if (node.count > 0) {
+                for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                    sum += SolidAngle(triangles[order[i]], pnt);
+                }
+            }
+            else {
+                stack.push_back(index + 1);
+                stack.push_back(node.right);
+            }
+        }
+        return sum / (4.0 * std::numbers::pi);
+    }
+
+private:
+    static double SolidAngle(const Triangle& tria, const Base::Vector3d& pnt)
+    {
+        // A. Van Oosterom, J. Strackee, "The Solid Angle of a Plane Triangle"
+        Base::Vector3d a = Base::toVector<double>(tria[0]) - pnt;
+        Base::Vector3d b = Base::toVector<double>(tria[1]) - pnt;
+        Base::Vector3d c = Base::toVector<double>(tria[2]) - pnt;
+        double la = a.Length();
+        double lb = b.Length();
+        double lc = c.Length();
+        double numerator = a * (b % c);
+        double denominator = la * lb * lc + (a * b) * lc + (b * c) * la + (c * a) * lb;
+        return 2.0 * std::atan2(numerator, denominator);
+    }
+
+    std::size_t Build(std::size_t first, std::size_t count)
+    {
+        std::size_t index = nodes.size();
+        nodes.emplace_back();
+        if (count <= leafSize) {
+            Node& node = nodes[index];
+            node.first = first;
+            node.count = count;
+            double area = 0.0;
+            for (std::size_t i = first; i < first + count; i++) {
+                const Triangle& tria = triangles[order[i]];
+                node.box.Add(boundBox(tria));
+                Base::Vector3d p0 = Base::toVector<double>(tria[0]);
+                Base::Vector3d p1 = Base::toVector<double>(tria[1]);
+                Base::Vector3d p2 = Base::toVector<double>(tria[2]);
+                Base::Vector3d normal = (p1 - p0) % (p2 - p0) * 0.5;
+                double len = normal.Length();
+                node.areaNormal += normal;
+                node.center += centers[order[i]] * len;
+                area += len;
+            }
+            node.center = area > 0.0 ? node.center / area : centers[order[first]];
+            node.area = area;
+            for (std::size_t i = first; i < first + count; i++) {
+                for (const auto& it : triangles[order[i]]) {
+                    double dist = (Base::toVector<double>(it) - node.center).Length();
+                    node.radius = std::max(node.radius, dist);
+                }
+            }
+            return index;
+        }
+
+        Base::BoundBox3d box;
+        for (std::size_t i = first; i < first + count; i++) {
+            box.Add(centers[order[i]]);
+        }
+        double lx = box.LengthX();
+        double ly = box.LengthY();
+        double lz = box.LengthZ();
+        unsigned short axis = (lx >= ly && lx >= lz) ? 0 : (ly >= lz ? 1 : 2);
+        std::size_t half = count / 2;
+        std::nth_element(order.begin() + long(first),
+                         order.begin() + long(first + half),
+                         order.begin() + long(first + count),
+                         [this, axis](std::size_t i, std::size_t j) {
+                             return centers[i][axis] < centers[j][axis];
+                         });
+
+        std::size_t left = Build(first, half);
+        std::size_t right = Build(first + half, count - half);
+        const Node& nodeL = nodes[left];
+        const Node& nodeR = nodes[right];
+        Node& node = nodes[index];
+        node.right = right;
+        node.box = nodeL.box;
+        node.box.Add(nodeR.box);
+        node.areaNormal = nodeL.areaNormal + nodeR.areaNormal;
+        node.area = nodeL.area + nodeR.area;
+        node.center = node.area > 0.0
+            ? (nodeL.center * nodeL.area + nodeR.center * nodeR.area) / node.area
+            : (nodeL.center + nodeR.center) / 2.0;
+        node.radius = std::max((nodeL.center - node.center).Length() + nodeL.radius,
+                               (nodeR.center - node.center).Length() + nodeR.radius);
+        return index;
+    }
+
+private:
+    static constexpr std::size_t leafSize = 4;
+    static constexpr double farField = 2.0;
+
+    struct Node
+    {
+        Base::BoundBox3f box;
+        Base::Vector3d center;
+        Base::Vector3d areaNormal;
+        double area {};
+        double radius {};
+        std::size_t first {};
+        std::size_t count {};
+        std::size_t right {};
+    };
+
+    const std::vector<Triangle>& triangles;
+    std::vector<Base::Vector3d> centers;
+    std::vector<std::size_t> order;
+    std::vector<Node> nodes;
+};
+
+// Computes the interval along the direction \a dir of the segment in which the triangle crosses
+// the plane. The signs \a side are the exact orientations of the corners.
+std::pair<double, double> crossingInterval(const Triangle& tria,
+                                           const std::array<int, 3>& side,
+                                           const Plane& plane,
+                                           const Base::Vector3d& dir)
+{
+    double lo = std::numeric_limits<double>::max();
+    double hi = -std::numeric_limits<double>::max();
+    auto add = [&](const Base::Vector3d& pnt) {
+        double value = pnt * dir;
+        lo = std::min(lo, value);
+        hi = std::max(hi, value);
+    };
+    for (std::size_t i = 0; i < 3; i++) {
+        std::size_t j = (i + 1) % 3;
+        Base::Vector3d pi = Base::toVector<double>(tria[i]);
+        if (side[i] == 0) {
+            add(pi);
+        }
+        else if (side[i] * side[j] < 0) {
+            Base::Vector3d pj = Base::toVector<double>(tria[j]);
+            double di = plane.Distance(pi);
+            double dj = plane.Distance(pj);
+            double param = di != dj ? std::clamp(di / (di - dj), 0.0, 1.0) : 0.5;
+            add(pi + (pj - pi) * param);
+        }
+    }
+    return {lo, hi};
+}
+
+bool crossesPlane(const std::array<int, 3>& side)
+{
+    bool below = std::find(side.begin(), side.end(), -1) != side.end();
+    bool above = std::find(side.begin(), side.end(), 1) != side.end();
+    return below && above;
+}
+
+bool touchesPlane(const std::array<int, 3>& side)
+{
+    bool onPlane = std::find(side.begin(), side.end(), 0) != side.end();
+    bool offPlane = side[0] != 0 || side[1] != 0 || side[2] != 0;
+    return offPlane && (onPlane || crossesPlane(side));
+}
+
+struct Contact
+{
+    bool touch = false;
+    bool splitFirst = false;
+    bool splitSecond = false;
+};
+
+// Checks whether the triangles have a point in common. A triangle must be split by the plane of
+// the other one if it crosses this plane. Coplanar triangles are ignored.
+Contact triangleContact(const Triangle& tria1, const Triangle& tria2)
+{
+    Contact contact;
+    std::array<int, 3> side1 {};
+    for (std::size_t i = 0; i < 3; i++) {
+        side1[i] = orient3d(tria2[0], tria2[1], tria2[2], tria1[i]);
+    }
+    if (!touchesPlane(side1)) {
+        return contact;
+    }
+    std::array<int, 3> side2 {};
+    for (std::size_t i = 0; i < 3; i++) {
+        side2[i] = orient3d(tria1[0], tria1[1], tria1[2], tria2[i]);
+    }
+    if (!touchesPlane(side2)) {
+        return contact;
+    }
+
+    Plane plane1(tria1);
+    Plane plane2(tria2);
+    Base::Vector3d dir = plane1.normal % plane2.normal;
+    auto [lo1, hi1] = crossingInterval(tria1, side1, plane2, dir);
+    auto [lo2, hi2] = crossingInterval(tria2, side2, plane1, dir);
+    if (std::max(lo1, lo2) <= std::min(hi1, hi2)) {
+        contact.touch = true;
+        contact.splitFirst = crossesPlane(side1);
+        contact.splitSecond = crossesPlane(side2);
+    }
+    return contact;
+}
+
+bool lexicographicLess(const Base::Vector3d& p, const Base::Vector3d& q)
+{
+    return std::tie(p.x, p.y, p.z) < std::tie(q.x, q.y, q.z);
+}
+
+// The intersection point of the segment with the plane. The result doesn't depend on the
+// direction of the segment so that neighbouring pieces get identical points.
+Base::Vector3d crossingPoint(Base::Vector3d p, double dp, Base::Vector3d q, double dq)
+{
+    if (lexicographicLess(q, p)) {
+        std::swap(p, q);
+        std::swap(dp, dq);
+    }
+    return p + (q - p) * (dp / (dp - dq));
+}
+
+// The point where the line through the edge points crosses the plane. Both meshes compute the
+// points on an edge with the same arguments so that they get identical results.
+Base::Vector3d edgePoint(const Base::Vector3d& p1, const Base::Vector3d& p2, const Plane& plane)
+{
+    double d1 = plane.Distance(p1);
+    double d2 = plane.Distance(p2);
+    return p1 + (p2 - p1) * (d1 / (d1 - d2));
+}
+
+// A corner of a piece of a facet. The planes of the facets \a on1 and \a on2 of the other mesh
+// pass through the corner by construction.
+struct Corner
+{
+    Base::Vector3d pnt;
+    FacetIndex on1 = FACET_INDEX_MAX;
+    FacetIndex on2 = FACET_INDEX_MAX;
+
+    bool IsOn(FacetIndex index) const
+    {
+        return index != FACET_INDEX_MAX && (on1 == index || on2 == index);
+    }
+};
+
+using Polygon = std::vector<Corner>;
+
+// A plane of a facet of the other mesh that cuts a facet
+struct Cut
+{
+    FacetIndex facet;
+    Plane plane;
+};
+
+// Triangulates the convex polygon. Polygons with more than three corners get a fan around their
+// centroid because the corners may be collinear.
+void triangulate(const Polygon& corners,
+                 bool flip,
+                 std::vector<std::array<Base::Vector3d, 3>>& triangles)
+{
+    std::vector<Base::Vector3d> poly;
+    poly.reserve(corners.size());
+    for (const auto& it : corners) {
+        if (poly.empty() || poly.back() != it.pnt) {
+            poly.push_back(it.pnt);
+        }
+    }
+    while (poly.size() > 1 && poly.front() == poly.back()) {
+        poly.pop_back();
+    }
+    if (poly.size() < 3) {
+        return;
+    }
+    if (flip) {
+        std::reverse(poly.begin(), poly.end());
+    }
+    if (poly.size() == 3) {
+        triangles.push_back({poly[0], poly[1], poly[2]});
+        return;
+    }
+
+    Base::Vector3d center;
+    for (const auto& it : poly) {
+        center += it;
+    }
+    center /= double(poly.size());
+    for (std::size_t i = 0; i < poly.size(); i++) {
+        triangles.push_back({center, poly[i], poly[(i + 1) % poly.size()]});
+    }
+}
+
+Base::Vector3d centerOf(const Polygon& poly)
+{
+    Base::Vector3d center;
+    for (const auto& it : poly) {
+        center += it.pnt;
+    }
+    return center / double(poly.size());
+}
+
+// A piece of a facet that was split by the planes of the other mesh
+struct Piece
+{
+    FacetIndex facet;
+    Polygon corners;
+};
+
+// The location of a facet or piece relative to the other mesh. On a coplanar facet of the other
+// mesh the winding number is 0.5, so these pieces are told apart by the orientation of the facets.
+enum Location : unsigned char
+{
+    Outside = 1,
+    Inside = 2,
+    SameCoplanar = 4,
+    OppositeCoplanar = 8
+};
+
+// Splits the facets of a mesh along the planes of the crossing facets of the other mesh and
+// classifies the pieces as inside or outside of the other mesh.
+class MeshSplitter
+{
+public:
+    MeshSplitter(const MeshKernel& kernel,
+                 const std::vector<Triangle>& triangles,
+                 const MeshKernel& other,
+                 const std::vector<Triangle>& otherTriangles,
+                 double eps,
+                 double tolerance)
+        : kernel(kernel)
+        , triangles(triangles)
+        , other(other)
+        , otherTriangles(otherTriangles)
+        , eps(eps)
+        , tolerance(tolerance)
+        , cuts(triangles.size())
+        , touched(triangles.size())
+    {}
+
+    void AddCut(FacetIndex index, FacetIndex otherIndex, const Plane& plane)
+    {
+        cuts[index].push_back({otherIndex, plane});
+    }
+
+    // Facets that touch the other mesh are classified separately because the intersection curve
+    // may run along their edges
+    void AddContact(FacetIndex index)
+    {
+        touched[index] = 1;
+    }
+
+    void Split()
+    {
+        std::vector<FacetIndex> cut;
+        for (FacetIndex i = 0; i < cuts.size(); i++) {
+            if (touched[i] != 0) {
+                RemoveDuplicateCuts(i);
+                cut.push_back(i);
+            }
+        }
+
+        RegisterEdgePoints(cut);
+
+        auto blocks = parallel_blocks(cut.size(), 100, [&](std::size_t begin, std::size_t end) {
+            std::vector<Piece> result;
+            for (std::size_t i = begin; i < end; i++) {
+                std::vector<Polygon> parts {FacetPolygon(cut[i])};
+                for (const auto& it : cuts[cut[i]]) {
+                    std::vector<Polygon> next;
+                    for (const auto& poly : parts) {
+                        Polygon below;
+                        Polygon above;
+                        SplitPolygon(cut[i], poly, it, below, above);
+                        if (!below.empty()) {
+                            next.push_back(std::move(below));
+                        }
+                        if (!above.empty()) {
+                            next.push_back(std::move(above));
+                        }
+                    }
+                    parts.swap(next);
+                }
+                for (auto& it : parts) {
+                    result.push_back({cut[i], std::move(it)});
+                }
+            }
+            return result;
+        });
+
+        for (auto& block : blocks) {
+            std::move(block.begin(), block.end(), std::back_inserter(pieces));
+        }
+    }
+
+    void Classify(const TriangleTree& tree)
+    {
+        pieceLocation.resize(pieces.size());
+        parallel_blocks(pieces.size(), 100, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                const Piece& piece = pieces[i];
+                pieceLocation[i] = Locate(tree, piece.facet, centerOf(piece.corners));
+            }
+            return 0;
+        });
+
+        // all facets of a connected region that isn't cut lie on the same side
+        const MeshFacetArray& facets = kernel.GetFacets();
+        std::vector<FacetIndex> seeds;
+        std::vector<FacetIndex> region(facets.size(), FACET_INDEX_MAX);
+        for (FacetIndex i = 0; i < facets.size(); i++) {
+            if (touched[i] != 0 || region[i] != FACET_INDEX_MAX) {
+                continue;
+            }
+            FacetIndex id = seeds.size();
+            seeds.push_back(i);
+            std::vector<FacetIndex> stack {i};
+            region[i] = id;
+            while (!stack.empty()) {
+                FacetIndex index = stack.back();
+                stack.pop_back();
+                for (FacetIndex neighbour : facets[index]._aulNeighbours) {
+                    if (neighbour != FACET_INDEX_MAX && touched[neighbour] == 0
+                        && region[neighbour] == FACET_INDEX_MAX) {
+                        region[neighbour] = id;
+                        stack.push_back(neighbour);
+                    }
+                }
+            }
+        }
+
+        std::vector<Location> seedLocation(seeds.size());
+        parallel_blocks(seeds.size(), 100, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                FacetIndex seed = seeds[i];
+                seedLocation[i] = Locate(tree, seed, centerOf(FacetPolygon(seed)));
+            }
+            return 0;
+        });
+
+        facetLocation.resize(facets.size());
+        for (FacetIndex i = 0; i < facets.size(); i++) {
+            if (region[i] != FACET_INDEX_MAX) {
+                facetLocation[i] = seedLocation[region[i]];
+            }
+        }
+    }
+
+    // Adds the facets and pieces whose location is one of \a locations
+    void Collect(unsigned char locations,
+                 bool flip,
+                 std::vector<std::array<Base::Vector3d, 3>>& result) const
+    {
+        for (FacetIndex i = 0; i < touched.size(); i++) {
+            if (touched[i] == 0 && (facetLocation[i] & locations) != 0) {
+                triangulate(FacetPolygon(i), flip, result);
+            }
+        }
+        for (std::size_t i = 0; i < pieces.size(); i++) {
+            if ((pieceLocation[i] & locations) != 0) {
+                triangulate(pieces[i].corners, flip, result);
+            }
+        }
+    }
+
+private:
+    using EdgeKey = std::pair<PointIndex, PointIndex>;
+
+    static EdgeKey MakeKey(PointIndex p1, PointIndex p2)
+    {
+        return {std::min(p1, p2), std::max(p1, p2)};
+    }
+
+    // Locates the point \a pnt of the facet \a index. If it lies on a coplanar facet of the other
+    // mesh the result depends on whether the normals of both facets point in the same direction.
+    Location Locate(const TriangleTree& tree, FacetIndex index, const Base::Vector3d& pnt) const
+    {
+        const Triangle& tria = triangles[index];
+        Base::BoundBox3f box;
+        box.Add(Base::toVector<float>(pnt));
+        box.Enlarge(float(tolerance));
+        int orientation = 0;
+        tree.Query(box, [&](std::size_t j) {
+            if (orientation == 0) {
+                orientation = CoplanarOrientation(tria, otherTriangles[j], pnt);
+            }
+        });
+        if (orientation != 0) {
+            return orientation > 0 ? SameCoplanar : OppositeCoplanar;
+        }
+        return tree.WindingNumber(pnt) > 0.5 ? Inside : Outside;
+    }
+
+    // Returns 1 or -1 if \a tria lies in the plane of \a otherTria and \a pnt lies inside
+    // \a otherTria, depending on whether their normals have the same direction, and 0 otherwise.
+    int CoplanarOrientation(const Triangle& tria,
+                            const Triangle& otherTria,
+                            const Base::Vector3d& pnt) const
+    {
+        Plane plane(otherTria);
+        for (const auto& it : tria) {
+            if (std::fabs(plane.Distance(Base::toVector<double>(it))) > tolerance) {
+                return 0;
+            }
+        }
+        for (std::size_t i = 0; i < 3; i++) {
+            Base::Vector3d p1 = Base::toVector<double>(otherTria[i]);
+            Base::Vector3d p2 = Base::toVector<double>(otherTria[(i + 1) % 3]);
+            Base::Vector3d dir = p2 - p1;
+            if (((dir % (pnt - p1)) * plane.normal) < -tolerance * dir.Length()) {
+                return 0;
+            }
+        }
+        return Plane(tria).normal * plane.normal > 0.0 ? 1 : -1;
+    }
+
+    // The planes of coplanar facets of the other mesh differ by rounding errors and would cut off
+    // thin slivers. Planes are considered equal if they pass the corners of the facet within the
+    // tolerance.
+    void RemoveDuplicateCuts(FacetIndex index)
+    {
+        const Triangle& tria = triangles[index];
+        std::vector<Cut> unique;
+        for (const auto& it : cuts[index]) {
+            bool found = std::any_of(unique.begin(), unique.end(), [&](const Cut& other) {
+                return std::all_of(tria.begin(), tria.end(), [&](const Base::Vector3f& pnt) {
+                    Base::Vector3d pnt3d = Base::toVector<double>(pnt);
+                    double dist1 = it.plane.Distance(pnt3d);
+                    double dist2 = other.plane.Distance(pnt3d);
+                    return std::fabs(dist1 - dist2) <= tolerance;
+                });
+            });
+            if (!found) {
+                unique.push_back(it);
+            }
+        }
+        cuts[index].swap(unique);
+    }
+
+    // Collects the points where the edges of cut facets cross the planes. The points are computed
+    // from the edge points in a fixed order so that both facets of an edge get the same points.
+    void RegisterEdgePoints(const std::vector<FacetIndex>& cut)
+    {
+        const MeshPointArray& points = kernel.GetPoints();
+        const MeshFacetArray& facets = kernel.GetFacets();
+        auto blocks = parallel_blocks(cut.size(), 100, [&](std::size_t begin, std::size_t end) {
+            std::vector<std::pair<EdgeKey, std::pair<double, Corner>>> result;
+            for (std::size_t i = begin; i < end; i++) {
+                const MeshFacet& facet = facets[cut[i]];
+                for (std::size_t j = 0; j < 3; j++) {
+                    EdgeKey key = MakeKey(facet._aulPoints[j], facet._aulPoints[(j + 1) % 3]);
+                    Base::Vector3d p1 = Base::toVector<double>(points[key.first]);
+                    Base::Vector3d p2 = Base::toVector<double>(points[key.second]);
+                    for (const auto& it : cuts[cut[i]]) {
+                        double d1 = it.plane.Distance(p1);
+                        double d2 = it.plane.Distance(p2);
+                        if ((d1 > eps && d2 < -eps) || (d1 < -eps && d2 > eps)) {
+                            Corner corner {edgePoint(p1, p2, it.plane), it.facet};
+                            result.emplace_back(key, std::make_pair(d1 / (d1 - d2), corner));
+                        }
+                    }
+                }
+            }
+            return result;
+        });
+
+        for (const auto& block : blocks) {
+            for (const auto& it : block) {
+                edgePoints[it.first].push_back(it.second);
+            }
+        }
+
+        for (auto& it : edgePoints) {
+            double len = (points[it.first.second] - points[it.first.first]).Length();
+            double minParam = len > 0.0F ? eps / len : 1.0;
+            auto& list = it.second;
+            std::sort(list.begin(), list.end(), [](const auto& p1, const auto& p2) {
+                return p1.first < p2.first;
+            });
+            std::vector<std::pair<double, Corner>> unique;
+            for (const auto& jt : list) {
+                if (jt.first <= minParam || jt.first >= 1.0 - minParam) {
+                    continue;
+                }
+                if (unique.empty() || jt.first - unique.back().first > minParam) {
+                    unique.push_back(jt);
+                }
+            }
+            list.swap(unique);
+        }
+    }
+
+    // The corners of the facet including the points registered on its edges
+    Polygon FacetPolygon(FacetIndex index) const
+    {
+        const MeshPointArray& points = kernel.GetPoints();
+        const MeshFacet& facet = kernel.GetFacets()[index];
+        Polygon poly;
+        for (std::size_t i = 0; i < 3; i++) {
+            PointIndex p1 = facet._aulPoints[i];
+            PointIndex p2 = facet._aulPoints[(i + 1) % 3];
+            poly.push_back({Base::toVector<double>(points[p1])});
+            auto it = edgePoints.find(MakeKey(p1, p2));
+            if (it == edgePoints.end()) {
+                continue;
+            }
+            if (p1 < p2) {
+                for (const auto& jt : it->second) {
+                    poly.push_back(jt.second);
+                }
+            }
+            else {
+                for (auto jt = it->second.rbegin(); jt != it->second.rend(); ++jt) {
+                    poly.push_back(jt->second);
+                }
+            }
+        }
+        return poly;
+    }
+
+    // A corner on the planes of two neighbouring facets of the other mesh lies on their common
+    // edge. It's computed like the points registered on this edge by the other mesh.
+    Base::Vector3d EdgeCorner(FacetIndex index, const Corner& corner) const
+    {
+        if (corner.on1 == FACET_INDEX_MAX || corner.on2 == FACET_INDEX_MAX) {
+            return corner.pnt;
+        }
+        const MeshFacet& facet = other.GetFacets()[corner.on1];
+        for (std::size_t i = 0; i < 3; i++) {
+            if (facet._aulNeighbours[i] != corner.on2) {
+                continue;
+            }
+            EdgeKey key = MakeKey(facet._aulPoints[i], facet._aulPoints[(i + 1) % 3]);
+            Base::Vector3d p1 = Base::toVector<double>(other.GetPoints()[key.first]);
+            Base::Vector3d p2 = Base::toVector<double>(other.GetPoints()[key.second]);
+            Plane plane(triangles[index]);
+            if (plane.Distance(p1) == plane.Distance(p2)) {
+                break;
+            }
+            return edgePoint(p1, p2, plane);
+        }
+        return corner.pnt;
+    }
+
+    // Splits the convex polygon by the plane. Points closer than eps to the plane are considered
+    // to lie on it. If the polygon isn't crossed it's completely copied to one side.
+    void SplitPolygon(FacetIndex index,
+                      const Polygon& poly,
+                      const Cut& cut,
+                      Polygon& below,
+                      Polygon& above) const
+    {
+        std::size_t count = poly.size();
+        std::vector<double> dist(count);
+        std::vector<int> side(count);
+        bool hasBelow = false;
+        bool hasAbove = false;
+        for (std::size_t i = 0; i < count; i++) {
+            dist[i] = cut.plane.Distance(poly[i].pnt);
+            side[i] = dist[i] > eps ? 1 : (dist[i] < -eps ? -1 : 0);
+            hasBelow = hasBelow || side[i] < 0;
+            hasAbove = hasAbove || side[i] > 0;
+        }
+        if (!hasBelow || !hasAbove) {
+            (hasBelow ? below : above) = poly;
+            return;
+        }
+
+        for (std::size_t i = 0; i < count; i++) {
+            std::size_t j = (i + 1) % count;
+            if (side[i] <= 0) {
+                below.push_back(poly[i]);
+            }
+            if (side[i] >= 0) {
+                above.push_back(poly[i]);
+            }
+            if (side[i] * side[j] < 0) {
+                const Corner& c1 = poly[i];
+                const Corner& c2 = poly[j];
+                Corner corner;
+                corner.pnt = crossingPoint(c1.pnt, dist[i], c2.pnt, dist[j]);
+                if (c1.IsOn(c2.on1)) {
+                    corner.on1 = c2.on1;
+                }
+                else if (c1.IsOn(c2.on2)) {
+                    corner.on1 = c2.on2;
+                }
+                corner.on2 = cut.facet;
+                corner.pnt = EdgeCorner(index, corner);
+                below.push_back(corner);
+                above.push_back(corner);
+            }
+        }
+    }
+
+private:
+    const MeshKernel& kernel;
+    const std::vector<Triangle>& triangles;
+    const MeshKernel& other;
+    const std::vector<Triangle>& otherTriangles;
+    double eps;
+    double tolerance;
+    std::vector<std::vector<Cut>> cuts;
+    std::vector<char> touched;
+    std::map<EdgeKey, std::vector<std::pair<double, Corner>>> edgePoints;
+    std::vector<Piece> pieces;
+    std::vector<Location> pieceLocation;
+    std::vector<Location> facetLocation;
+};
+
+// Merges points closer than the tolerance and builds the mesh structure. Edges of the result that
+// contain a point of another border edge are split there. This is done in double precision because
+// rounding to float may separate the points where both meshes meet or merge close points that
+// aren't connected.
+class MeshWelder
+{
+public:
+    MeshWelder(double tolerance, double seamTolerance)
+        : tolerance(tolerance)
+        , seamTolerance(seamTolerance)
+    {}
+
+    void AddTriangle(const std::array<Base::Vector3d, 3>& tria)
+    {
+        std::array<PointIndex, 3> index {};
+        for (std::size_t i = 0; i < 3; i++) {
+            index[i] = AddPoint(tria[i]);
+        }
+        if (index[0] != index[1] && index[1] != index[2] && index[2] != index[0]) {
+            facets.push_back(index);
+        }
+    }
+
+    void Build(MeshKernel& kernel)
+    {
+        RemoveFoldedFacets();
+        MergeBorderPoints();
+        RemoveFoldedFacets();
+        SplitBorderEdges();
+        MeshPointArray pointArray;
+        pointArray.reserve(points.size());
+        for (const auto& it : points) {
+            pointArray.push_back(MeshPoint(Base::toVector<float>(it)));
+        }
+        MeshFacetArray facetArray;
+        facetArray.reserve(facets.size());
+        for (const auto& it : facets) {
+            facetArray.push_back(MeshFacet(it[0], it[1], it[2]));
+        }
+        kernel.Adopt(pointArray, facetArray, true);
+    }
+
+private:
+    using Cell = std::array<std::int64_t, 3>;
+
+    Cell CellOf(const Base::Vector3d& pnt) const
+    {
+        return {std::int64_t(std::floor(pnt.x / tolerance)),
+                std::int64_t(std::floor(pnt.y / tolerance)),
+                std::int64_t(std::floor(pnt.z / tolerance))};
+    }
+
+    static std::uint64_t HashOf(const Cell& cell)
+    {
+        return std::uint64_t(cell[0]) * 73856093U ^ std::uint64_t(cell[1]) * 19349663U
+            ^ std::uint64_t(cell[2]) * 83492791U;
+    }
+
+    PointIndex AddPoint(const Base::Vector3d& pnt)
+    {
+        Cell cell = CellOf(pnt);
+        for (std::int64_t i = -1; i <= 1; i++) {
+            for (std::int64_t j = -1; j <= 1; j++) {
+                for (std::int64_t k = -1; k <= 1; k++) {
+                    auto it = grid.find(HashOf({cell[0] + i, cell[1] + j, cell[2] + k}));
+                    if (it == grid.end()) {
+                        continue;
+                    }
+                    for (PointIndex index : it->second) {
+                        if (Base::Distance(points[index], pnt) <= tolerance) {
+                            return index;
+                        }
+                    }
+                }
+            }
+        }
+        PointIndex index = points.size();
+        points.push_back(pnt);
+        grid[HashOf(cell)].push_back(index);
+        return index;
+    }
+
+    using EdgeMap = std::map<std::pair<PointIndex, PointIndex>, int>;
+
+    // Pieces thinner than the tolerance collapse to pairs of facets with opposite orientation
+    // that cancel each other. Where both meshes touch tangentially with the same orientation
+    // their pieces collapse to duplicate facets of which one is kept.
+    void RemoveFoldedFacets()
+    {
+        std::map<std::array<PointIndex, 3>, std::vector<std::size_t>> folds;
+        for (std::size_t i = 0; i < facets.size(); i++) {
+            std::array<PointIndex, 3> key = facets[i];
+            std::rotate(key.begin(), std::min_element(key.begin(), key.end()), key.end());
+            if (key[1] > key[2]) {
+                std::swap(key[1], key[2]);
+            }
+            folds[key].push_back(i);
+        }
+
+        std::vector<char> removed(facets.size());
+        for (const auto& it : folds) {
+            std::vector<std::size_t> forward;
+            std::vector<std::size_t> backward;
+            for (std::size_t index : it.second) {
+                const auto& facet = facets[index];
+                std::size_t first = std::min_element(facet.begin(), facet.end()) - facet.begin();
+                bool same = facet[(first + 1) % 3] == it.first[1];
+                (same ? forward : backward).push_back(index);
+            }
+            if (forward.size() < backward.size()) {
+                forward.swap(backward);
+            }
+            for (std::size_t index : backward) {
+                removed[index] = 1;
+            }
+            std::size_t keep = forward.size() > backward.size() ? 1 : 0;
+            for (std::size_t i = keep; i < forward.size(); i++) {
+                removed[forward[i]] = 1;
+            }
+        }
+
+        std::vector<std::array<PointIndex, 3>> result;
+        result.reserve(facets.size());
+        for (std::size_t i = 0; i < facets.size(); i++) {
+            if (removed[i] == 0) {
+                result.push_back(facets[i]);
+            }
+        }
+        facets.swap(result);
+    }
+
+    static std::pair<PointIndex, PointIndex> EdgeOf(PointIndex p1, PointIndex p2)
+    {
+        return {std::min(p1, p2), std::max(p1, p2)};
+    }
+
+    EdgeMap CountEdges() const
+    {
+        EdgeMap edges;
+        for (const auto& it : facets) {
+            for (std::size_t i = 0; i < 3; i++) {
+                edges[EdgeOf(it[i], it[(i + 1) % 3])]++;
+            }
+        }
+        return edges;
+    }
+
+    // The points of border edges sorted by their x coordinate
+    std::vector<PointIndex> BorderPoints(const EdgeMap& edges) const
+    {
+        std::vector<PointIndex> border;
+        for (const auto& it : edges) {
+            if (it.second == 1) {
+                border.push_back(it.first.first);
+                border.push_back(it.first.second);
+            }
+        }
+        std::sort(border.begin(), border.end(), [this](PointIndex p1, PointIndex p2) {
+            return std::tie(points[p1].x, p1) < std::tie(points[p2].x, p2);
+        });
+        border.erase(std::unique(border.begin(), border.end()), border.end());
+        return border;
+    }
+
+    // Where the intersection curve crosses nearly coplanar facets its points computed from both
+    // meshes may differ by more than the tolerance. Only the points of border edges are merged
+    // with the larger seam tolerance so that close points in the inner of the result are kept.
+    void MergeBorderPoints()
+    {
+        std::vector<PointIndex> border = BorderPoints(CountEdges());
+        if (border.empty()) {
+            return;
+        }
+
+        std::vector<PointIndex> mapping(points.size());
+        std::iota(mapping.begin(), mapping.end(), 0);
+        bool merged = false;
+        for (std::size_t i = 0; i < border.size(); i++) {
+            PointIndex p1 = border[i];
+            if (mapping[p1] != p1) {
+                continue;
+            }
+            for (std::size_t j = i + 1; j < border.size(); j++) {
+                PointIndex p2 = border[j];
+                if (points[p2].x - points[p1].x > seamTolerance) {
+                    break;
+                }
+                if (mapping[p2] == p2 && Base::Distance(points[p1], points[p2]) <= seamTolerance) {
+                    mapping[p2] = p1;
+                    merged = true;
+                }
+            }
+        }
+        if (!merged) {
+            return;
+        }
+
+        std::vector<std::array<PointIndex, 3>> result;
+        result.reserve(facets.size());
+        for (const auto& it : facets) {
+            std::array<PointIndex, 3> facet {mapping[it[0]], mapping[it[1]], mapping[it[2]]};
+            if (facet[0] != facet[1] && facet[1] != facet[2] && facet[2] != facet[0]) {
+                result.push_back(facet);
+            }
+        }
+        facets.swap(result);
+    }
+
+    void SplitBorderEdges()
+    {
+        EdgeMap edges = CountEdges();
+        std::vector<PointIndex> border = BorderPoints(edges);
+        if (border.empty()) {
+            return;
+        }
+
+        // border points that lie inside of a border edge
+        auto pointsOnEdge = [&](PointIndex p1, PointIndex p2) {
+            std::vector<std::pair<double, PointIndex>> inner;
+            const Base::Vector3d& start = points[p1];
+            Base::Vector3d dir = points[p2] - start;
+            double len2 = dir.Sqr();
+            if (len2 == 0.0) {
+                return inner;
+            }
+            double minX = std::min(start.x, points[p2].x) - seamTolerance;
+            double maxX = std::max(start.x, points[p2].x) + seamTolerance;
+            auto it = std::lower_bound(border.begin(),
+                                       border.end(),
+                                       minX,
+                                       [this](PointIndex p, double x) {
+                                           return points[p].x < x;
+                                       });
+            for (; it != border.end() && points[*it].x <= maxX; ++it) {
+                if (*it == p1 || *it == p2) {
+                    continue;
+                }
+                double param = (points[*it] - start) * dir / len2;
+                if (param <= 0.0 || param >= 1.0) {
+                    continue;
+                }
+                if (Base::Distance(start + dir * param, points[*it]) <= seamTolerance) {
+                    inner.emplace_back(param, *it);
+                }
+            }
+            std::sort(inner.begin(), inner.end());
+            return inner;
+        };
+
+        std::vector<std::array<PointIndex, 3>> result;
+        for (const auto& facet : facets) {
+            std::array<std::vector<std::pair<double, PointIndex>>, 3> inner;
+            int edgesWithPoints = 0;
+            for (std::size_t i = 0; i < 3; i++) {
+                PointIndex p1 = facet[i];
+                PointIndex p2 = facet[(i + 1) % 3];
+                if (edges[EdgeOf(p1, p2)] == 1) {
+                    inner[i] = pointsOnEdge(p1, p2);
+                    edgesWithPoints += inner[i].empty() ? 0 : 1;
+                }
+            }
+            if (edgesWithPoints == 0) {
+                result.push_back(facet);
+                continue;
+            }
+
+            std::vector<PointIndex> poly;
+            for (std::size_t i = 0; i < 3; i++) {
+                poly.push_back(facet[i]);
+                for (const auto& it : inner[i]) {
+                    poly.push_back(it.second);
+                }
+            }
+            if (edgesWithPoints == 1) {
+                // fan around the corner opposite to the split edge
+                std::size_t edge = !inner[0].empty() ? 0 : (!inner[1].empty() ? 1 : 2);
+                PointIndex apex = facet[(edge + 2) % 3];
+                auto start = std::find(poly.begin(), poly.end(), apex);
+                std::rotate(poly.begin(), start, poly.end());
+                for (std::size_t i = 1; i + 1 < poly.size(); i++) {
+                    result.push_back({apex, poly[i], poly[i + 1]});
+                }
+            }
+            else {
+                Base::Vector3d center;
+                for (PointIndex index : poly) {
+                    center += points[index];
+                }
+                center /= double(poly.size());
+                PointIndex apex = points.size();
+                points.push_back(center);
+                for (std::size_t i = 0; i < poly.size(); i++) {
+                    result.push_back({apex, poly[i], poly[(i + 1) % poly.size()]});
+                }
+            }
+        }
+        facets.swap(result);
+    }
+
+private:
+    double tolerance;
+    double seamTolerance;
+    std::vector<Base::Vector3d> points;
+    std::vector<std::array<PointIndex, 3>> facets;
+    std::unordered_map<std::uint64_t, std::vector<PointIndex>> grid;
+};
+
+std::vector<Triangle> trianglesOf(const MeshKernel& kernel)
+{
+    const MeshPointArray& points = kernel.GetPoints();
+    const MeshFacetArray& facets = kernel.GetFacets();
+    std::vector<Triangle> triangles;
+    triangles.reserve(facets.size());
+    for (const auto& it : facets) {
+        triangles.push_back(
+            {points[it._aulPoints[0]], points[it._aulPoints[1]], points[it._aulPoints[2]]});
+    }
+    return triangles;
+}
+
+}  // namespace
+
+MeshBoolean::MeshBoolean(const MeshKernel& mesh1,
+                         const MeshKernel& mesh2,
+                         MeshKernel& result,
+                         SetOperations::OperationType opType,
+                         float minDistanceToPoint)
+    : _mesh1(mesh1)
+    , _mesh2(mesh2)
+    , _result(result)
+    , _operationType(opType)
+    , _minDistanceToPoint(minDistanceToPoint)
+{}
+
+void MeshBoolean::Do()
+{
+    std::vector<Triangle> triangles1 = trianglesOf(_mesh1);
+    std::vector<Triangle> triangles2 = trianglesOf(_mesh2);
+    TriangleTree tree1(triangles1);
+    TriangleTree tree2(triangles2);
+
+    Base::BoundBox3f box = _mesh1.GetBoundBox();
+    box.Add(_mesh2.GetBoundBox());
+    double diagonal = box.IsValid() ? double(box.CalcDiagonalLength()) : 1.0;
+
+    // points closer than eps to a plane are considered to lie on it, points of the result closer
+    // than the tolerance are merged. The planes of coplanar facets differ by the float precision
+    // of their points, planes closer than the plane tolerance are merged.
+    double eps = diagonal * 1e-10;
+    double tolerance = diagonal * 1e-7;
+    double planeTolerance = diagonal * 1e-6;
+
+    // find the crossing and touching facets
+    auto blocks =
+        parallel_blocks(triangles1.size(), 1000, [&](std::size_t begin, std::size_t end) {
+            std::vector<std::tuple<FacetIndex, FacetIndex, Contact>> pairs;
+            for (std::size_t i = begin; i < end; i++) {
+                tree2.Query(boundBox(triangles1[i]), [&](std::size_t j) {
+                    Contact contact = triangleContact(triangles1[i], triangles2[j]);
+                    if (contact.touch) {
+                        pairs.emplace_back(i, j, contact);
+                    }
+                });
+            }
+            return pairs;
+        });
+
+    bool needSecond = _operationType != SetOperations::Inner
+        && _operationType != SetOperations::Outer;
+    MeshSplitter splitter1(_mesh1, triangles1, _mesh2, triangles2, eps, planeTolerance);
+    MeshSplitter splitter2(_mesh2, triangles2, _mesh1, triangles1, eps, planeTolerance);
+    for (const auto& block : blocks) {
+        for (const auto& [index1, index2, contact] : block) {
+            splitter1.AddContact(index1);
+            splitter2.AddContact(index2);
+            if (contact.splitFirst) {
+                splitter1.AddCut(index1, index2, Plane(triangles2[index2]));
+            }
+            if (contact.splitSecond) {
+                splitter2.AddCut(index2, index1, Plane(triangles1[index1]));
+            }
+        }
+    }
+
+    std::vector<std::array<Base::Vector3d, 3>> facets;
+    splitter1.Split();
+    splitter1.Classify(tree2);
+    if (needSecond) {
+        splitter2.Split();
+        splitter2.Classify(tree1);
+    }
+
+    // Where both meshes overlap with the same orientation the pieces of the first mesh are kept.
+    // Where they touch with opposite orientation the pieces of the first mesh are only kept if
+    // the second mesh is subtracted.
+    switch (_operationType) {
+        case SetOperations::Union:
+            splitter1.Collect(Outside | SameCoplanar, false, facets);
+            splitter2.Collect(Outside, false, facets);
+            break;
+        case SetOperations::Intersect:
+            splitter1.Collect(Inside | SameCoplanar, false, facets);
+            splitter2.Collect(Inside, false, facets);
+            break;
+        case SetOperations::Difference:
+            splitter1.Collect(Outside | OppositeCoplanar, false, facets);
+            splitter2.Collect(Inside, true, facets);
+            break;
+        case SetOperations::Inner:
+            splitter1.Collect(Inside | SameCoplanar, false, facets);
+            break;
+        case SetOperations::Outer:
+            splitter1.Collect(Outside | OppositeCoplanar, false, facets);
+            break;
+    }
+
+    // merge the points of both meshes that meet at the intersection curve
+    MeshWelder welder(tolerance, std::max(double(_minDistanceToPoint), tolerance));
+    for (const auto& it : facets) {
+        welder.AddTriangle(it);
+    }
+    welder.Build(_result);
+}
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association                    *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef MESH_BOOLEAN_H
+#define MESH_BOOLEAN_H
+
+#include "SetOperations.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshBoolean class computes the union, intersection or difference of two closed meshes.
+ *
+ * In contrast to SetOperations the decisions whether two facets intersect and on which side
+ * of a facet a point lies are made with exact orientation predicates. The facets are split
+ * along the planes of the intersecting facets of the other mesh and every piece is classified
+ * by its generalized winding number with respect to the other mesh, so that the result doesn't
+ * depend on the traversal of an intersection curve. The intersection test and the classification
+ * run in parallel.
+ *
+ * Pieces that lie on a coplanar facet of the other mesh have a winding number of 0.5 and are
+ * classified by the orientation of both facets instead. If the normals point in the same
+ * direction only the piece of the first mesh is kept by the union and the intersection, if they
+ * are opposite the piece of the first mesh is only kept by the difference.
+ */
+class MeshExport MeshBoolean
+{
+public:
+    /** Constructs the operation for the meshes \a mesh1 and \a mesh2. The result is written to
+     * \a result. Points of both meshes at the intersection curve closer than
+     * \a minDistanceToPoint are merged.
+     */
+    MeshBoolean(const MeshKernel& mesh1,
+                const MeshKernel& mesh2,
+                MeshKernel& result,
+                SetOperations::OperationType opType,
+                float minDistanceToPoint = 1e-5F);
+
+    /** Performs the operation. */
+    void Do();
+
+private:
+    const MeshKernel& _mesh1;
+    const MeshKernel& _mesh2;
+    MeshKernel& _result;
+    SetOperations::OperationType _operationType;
+    float _minDistanceToPoint;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_BOOLEAN_H
@@ -230,6 +230,7 @@ void CylinderFit::ProjectToCylinder()
             cPnt = proj + diff * _dRadius;
         }
     }
+    UpdateMoments();
 }
 
 // Compute approximations for the parameters using all points by computing a
@@ -409,38 +410,17 @@ void CylinderFit::findBestSolDirection(SolutionD& solDir)
 
 double CylinderFit::meanXObs()
 {
-    double mx = 0.0;
-    if (!_vPoints.empty()) {
-        for (const auto& it : _vPoints) {
-            mx += it.x;
-        }
-        mx /= double(_vPoints.size());
-    }
-    return mx;
+    return _moments.Mean().x;
 }
 
 double CylinderFit::meanYObs()
 {
-    double my = 0.0;
-    if (!_vPoints.empty()) {
-        for (const auto& it : _vPoints) {
-            my += it.y;
-        }
-        my /= double(_vPoints.size());
-    }
-    return my;
+    return _moments.Mean().y;
 }
 
 double CylinderFit::meanZObs()
 {
-    double mz = 0.0;
-    if (!_vPoints.empty()) {
-        for (const auto& it : _vPoints) {
-            mz += it.z;
-        }
-        mz /= double(_vPoints.size());
-    }
-    return mz;
+    return _moments.Mean().z;
 }
 
 // Set up the normal equation matrices
@@ -25,6 +25,8 @@
 
 #include <algorithm>
 #include <future>
+#include <thread>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +64,35 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/**
+ * Splits the range [0, count) into blocks of at least \a minBlockSize elements, calls
+ * func(begin, end) for each block in parallel and returns the results in block order.
+ */
+template<class Func>
+static auto parallel_blocks(std::size_t count, std::size_t minBlockSize, Func func)
+{
+    using Result = decltype(func(std::size_t(0), std::size_t(0)));
+    std::size_t threads = std::thread::hardware_concurrency();
+    threads = std::max<std::size_t>(1, std::min<std::size_t>(threads, count / minBlockSize));
+
+    std::vector<Result> results;
+    if (threads < 2) {
+        results.push_back(func(0, count));
+        return results;
+    }
+
+    std::vector<std::future<Result>> blocks;
+    std::size_t blockSize = count / threads;
+    for (std::size_t i = 0; i < threads; i++) {
+        std::size_t end = (i + 1 < threads) ? (i + 1) * blockSize : count;
+        blocks.push_back(std::async(std::launch::async, func, i * blockSize, end));
+    }
+    for (auto& it : blocks) {
+        results.push_back(it.get());
+    }
+    return results;
+}
+
 }  // namespace MeshCore
 
 
@@ -1105,14 +1105,12 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    auto clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
-
-    _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= rclMat;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
+    if (!_aclPointArray.empty()) {
+        // MeshPoint carries flags and properties, so the points are not packed
+        Base::Vector3f* points = _aclPointArray.data();
+        rclMat.multVec(points, _aclPointArray.size(), sizeof(MeshPoint));
     }
+    RecalcBoundBox();
 }
 
 void MeshKernel::Smooth(int iterations, float stepsize)
@@ -23,11 +23,16 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
 #endif
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Segmentation.h"
 
 using namespace MeshCore;
@@ -614,3 +619,516 @@ void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm
         }
     }
 }
+
+// --------------------------------------------------------
+
+namespace
+{
+enum class RansacShapeType
+{
+    Plane,
+    Cylinder,
+    Sphere
+};
+
+struct RansacShape
+{
+    RansacShapeType type {RansacShapeType::Plane};
+    Base::Vector3f base;  // point on plane, point on axis or center
+    Base::Vector3f axis;  // plane normal or cylinder axis
+    float radius {0.0F};
+
+    float Distance(const Base::Vector3f& pnt) const
+    {
+        switch (type) {
+            case RansacShapeType::Plane:
+                return std::fabs(pnt.DistanceToPlane(base, axis));
+            case RansacShapeType::Cylinder:
+                return std::fabs(pnt.DistanceToLine(base, axis) - radius);
+            case RansacShapeType::Sphere:
+                return std::fabs(Base::Distance(pnt, base) - radius);
+        }
+        return FLOAT_MAX;
+    }
+
+    Base::Vector3f Normal(const Base::Vector3f& pnt) const
+    {
+        Base::Vector3f dir;
+        switch (type) {
+            case RansacShapeType::Plane:
+                return axis;
+            case RansacShapeType::Cylinder:
+                dir = pnt - base;
+                dir = dir - axis * (dir * axis);
+                break;
+            case RansacShapeType::Sphere:
+                dir = pnt - base;
+                break;
+        }
+        dir.Normalize();
+        return dir;
+    }
+};
+
+struct RansacRequest
+{
+    MeshDistanceSurfaceSegment* segment;
+    RansacShapeType type;
+    float tolerance;
+    std::size_t minFacets;
+};
+
+struct RansacFacet
+{
+    Base::Vector3f points[3];
+    Base::Vector3f center;
+    Base::Vector3f normal;
+};
+
+// Closest point between the two lines p0 + t * d0 and p1 + s * d1
+bool closestPointOfLines(const Base::Vector3f& p0,
+                         const Base::Vector3f& d0,
+                         const Base::Vector3f& p1,
+                         const Base::Vector3f& d1,
+                         Base::Vector3f& center)
+{
+    Base::Vector3f w = p0 - p1;
+    float a = d0 * d0;
+    float b = d0 * d1;
+    float c = d1 * d1;
+    float d = d0 * w;
+    float e = d1 * w;
+    float den = a * c - b * b;
+    if (den <= 1e-4F * a * c) {
+        return false;
+    }
+    float t = (b * e - c * d) / den;
+    float s = (a * e - b * d) / den;
+    center = ((p0 + d0 * t) + (p1 + d1 * s)) * 0.5F;
+    return true;
+}
+
+// Interleaves the bits of the cell coordinates so that the facets of an octree cell
+// at any level are a contiguous range in the sorted array
+uint32_t mortonCode(uint32_t x, uint32_t y, uint32_t z)
+{
+    auto expand = [](uint32_t v) {
+        v = (v | (v << 16)) & 0x030000FF;
+        v = (v | (v << 8)) & 0x0300F00F;
+        v = (v | (v << 4)) & 0x030C30C3;
+        v = (v | (v << 2)) & 0x09249249;
+        return v;
+    };
+    return (expand(x) << 2) | (expand(y) << 1) | expand(z);
+}
+
+class RansacDetector
+{
+public:
+    static constexpr unsigned levels = 10;
+
+    RansacDetector(const MeshKernel& kernel, float maxAngle, unsigned int seed)
+        : kernel(kernel)
+        , minCosAngle(std::cos(maxAngle))
+        , rng(seed)
+    {
+        const MeshPointArray& points = kernel.GetPoints();
+        const MeshFacetArray& facets = kernel.GetFacets();
+        data.resize(facets.size());
+        for (std::size_t i = 0; i < facets.size(); i++) {
+            RansacFacet& face = data[i];
+            for (int j = 0; j < 3; j++) {
+                face.points[j] = points[facets[i]._aulPoints[j]];
+            }
+            face.center = (face.points[0] + face.points[1] + face.points[2]) / 3.0F;
+            face.normal = (face.points[1] - face.points[0]) % (face.points[2] - face.points[0]);
+            face.normal.Normalize();
+        }
+
+        Base::BoundBox3f bbox = kernel.GetBoundBox();
+        diagonal = bbox.CalcDiagonalLength();
+        float cells = float(1 << levels);
+        float len = std::max<float>({bbox.LengthX(), bbox.LengthY(), bbox.LengthZ(), FLOAT_EPS});
+        auto toCell = [cells, len](float v, float min) {
+            return uint32_t(std::min<float>(cells - 1.0F, (v - min) / len * cells));
+        };
+
+        codes.resize(data.size());
+        octree.reserve(data.size());
+        for (std::size_t i = 0; i < data.size(); i++) {
+            const Base::Vector3f& c = data[i].center;
+            codes[i] = mortonCode(toCell(c.x, bbox.MinX),
+                                  toCell(c.y, bbox.MinY),
+                                  toCell(c.z, bbox.MinZ));
+            octree.emplace_back(codes[i], FacetIndex(i));
+        }
+        std::sort(octree.begin(), octree.end());
+
+        assigned.resize(data.size(), 0);
+        remaining.resize(data.size());
+        std::iota(remaining.begin(), remaining.end(), FacetIndex(0));
+    }
+
+    void Run(const std::vector<RansacRequest>& requests)
+    {
+        // a few rounds in a row without a new segment means that all shapes large
+        // enough have been found with high probability
+        const int maxFailures = 5;
+        const int candidatesPerType = 32;
+        const std::size_t subsetSize = 5000;
+        const std::size_t minWork = 10000;
+
+        std::size_t minSize = FACET_INDEX_MAX;
+        for (const auto& it : requests) {
+            minSize = std::min(minSize, it.minFacets);
+        }
+
+        int failures = 0;
+        while (failures < maxFailures && remaining.size() >= minSize) {
+            // create candidates from samples in the same octree cell
+            std::vector<std::pair<RansacShape, std::size_t>> candidates;
+            for (std::size_t i = 0; i < requests.size(); i++) {
+                int found = 0;
+                for (int j = 0; j < 4 * candidatesPerType && found < candidatesPerType; j++) {
+                    std::array<FacetIndex, 3> sample {};
+                    RansacShape shape;
+                    shape.type = requests[i].type;
+                    if (Sample(sample) && Create(sample, requests[i].tolerance, shape)) {
+                        candidates.emplace_back(shape, i);
+                        found++;
+                    }
+                }
+            }
+            if (candidates.empty()) {
+                failures++;
+                continue;
+            }
+
+            // score the candidates on a random subset of the remaining facets
+            std::vector<FacetIndex> subset;
+            if (remaining.size() <= subsetSize) {
+                subset = remaining;
+            }
+            else {
+                std::sample(remaining.begin(),
+                            remaining.end(),
+                            std::back_inserter(subset),
+                            subsetSize,
+                            rng);
+            }
+            std::vector<std::size_t> scores(candidates.size());
+            auto scoreRange = [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    const auto& cand = candidates[i];
+                    float tol = requests[cand.second].tolerance;
+                    scores[i] = std::count_if(subset.begin(), subset.end(), [&](FacetIndex index) {
+                        return IsInlier(cand.first, index, tol);
+                    });
+                }
+                return 0;
+            };
+            parallel_blocks(candidates.size(), 1 + minWork / subset.size(), scoreRange);
+
+            std::size_t best =
+                std::max_element(scores.begin(), scores.end()) - scores.begin();
+            const RansacRequest& request = requests[candidates[best].second];
+            double expected = double(scores[best]) * remaining.size() / subset.size();
+            if (expected < double(request.minFacets)) {
+                failures++;
+                continue;
+            }
+
+            // refine the best candidate with all its inliers
+            RansacShape shape = candidates[best].first;
+            std::vector<FacetIndex> inliers = Inliers(shape, request.tolerance);
+            RansacShape refined = shape;
+            if (Refine(inliers, refined)) {
+                std::vector<FacetIndex> refinedInliers = Inliers(refined, request.tolerance);
+                if (refinedInliers.size() >= inliers.size()) {
+                    inliers.swap(refinedInliers);
+                }
+            }
+
+            // only connected patches make a segment
+            bool found = false;
+            for (auto& segm : Components(inliers)) {
+                if (segm.size() >= std::max<std::size_t>(request.minFacets, 2)) {
+                    for (FacetIndex index : segm) {
+                        assigned[index] = 1;
+                    }
+                    request.segment->AddSegment(segm);
+                    found = true;
+                }
+            }
+
+            if (found) {
+                failures = 0;
+                remaining.erase(std::remove_if(remaining.begin(),
+                                               remaining.end(),
+                                               [this](FacetIndex index) {
+                                                   return assigned[index] != 0;
+                                               }),
+                                remaining.end());
+            }
+            else {
+                failures++;
+            }
+        }
+    }
+
+private:
+    bool Sample(std::array<FacetIndex, 3>& sample)
+    {
+        if (remaining.size() < 3) {
+            return false;
+        }
+
+        // the first facet is chosen randomly, the others from an octree cell around it
+        std::uniform_int_distribution<std::size_t> first(0, remaining.size() - 1);
+        std::uniform_int_distribution<unsigned> level(1, levels);
+        sample[0] = remaining[first(rng)];
+        uint32_t code = codes[sample[0]];
+        auto lower = octree.begin();
+        auto upper = octree.end();
+        // go to a coarser level if the cell has too few facets
+        for (unsigned depth = level(rng); depth > 0; depth--) {
+            uint32_t mask = (uint64_t(1) << (3 * (levels - depth))) - 1;
+            lower = std::lower_bound(octree.begin(),
+                                     octree.end(),
+                                     std::make_pair(code & ~mask, FacetIndex(0)));
+            upper = std::upper_bound(octree.begin(),
+                                     octree.end(),
+                                     std::make_pair(code | mask, FACET_INDEX_MAX));
+            if (upper - lower >= 3) {
+                break;
+            }
+            lower = octree.begin();
+            upper = octree.end();
+        }
+
+        std::uniform_int_distribution<std::ptrdiff_t> other(0, upper - lower - 1);
+        for (int i = 1; i < 3; i++) {
+            bool ok = false;
+            for (int tries = 0; tries < 10 && !ok; tries++) {
+                FacetIndex index = (lower + other(rng))->second;
+                ok = assigned[index] == 0 && std::find(sample.begin(), sample.begin() + i, index)
+                    == sample.begin() + i;
+                sample[i] = index;
+            }
+            if (!ok) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Create(const std::array<FacetIndex, 3>& sample, float tol, RansacShape& shape) const
+    {
+        const Base::Vector3f& p0 = data[sample[0]].center;
+        const Base::Vector3f& p1 = data[sample[1]].center;
+        const Base::Vector3f& n0 = data[sample[0]].normal;
+        const Base::Vector3f& n1 = data[sample[1]].normal;
+
+        switch (shape.type) {
+            case RansacShapeType::Plane: {
+                const Base::Vector3f& p2 = data[sample[2]].center;
+                shape.base = p0;
+                shape.axis = (p1 - p0) % (p2 - p0);
+                if (shape.axis.Length() < FLOAT_EPS) {
+                    return false;
+                }
+                shape.axis.Normalize();
+            } break;
+            case RansacShapeType::Cylinder: {
+                // the axis is perpendicular to both normals, the center is where the normals
+                // meet in the plane perpendicular to the axis
+                shape.axis = n0 % n1;
+                if (shape.axis.Length() < FLOAT_EPS) {
+                    return false;
+                }
+                shape.axis.Normalize();
+                Base::Vector3f q0 = p0 - shape.axis * (p0 * shape.axis);
+                Base::Vector3f q1 = p1 - shape.axis * (p1 * shape.axis);
+                Base::Vector3f m0 = n0 - shape.axis * (n0 * shape.axis);
+                Base::Vector3f m1 = n1 - shape.axis * (n1 * shape.axis);
+                if (!closestPointOfLines(q0, m0, q1, m1, shape.base)) {
+                    return false;
+                }
+                shape.radius =
+                    (Base::Distance(q0, shape.base) + Base::Distance(q1, shape.base)) * 0.5F;
+            } break;
+            case RansacShapeType::Sphere: {
+                if (!closestPointOfLines(p0, n0, p1, n1, shape.base)) {
+                    return false;
+                }
+                shape.radius =
+                    (Base::Distance(p0, shape.base) + Base::Distance(p1, shape.base)) * 0.5F;
+            } break;
+        }
+
+        // large radii are better approximated by a plane
+        if (shape.type != RansacShapeType::Plane
+            && (shape.radius < tol || shape.radius > diagonal)) {
+            return false;
+        }
+
+        // all samples must be compatible with the shape
+        return std::all_of(sample.begin(), sample.end(), [&](FacetIndex index) {
+            return IsInlier(shape, index, tol);
+        });
+    }
+
+    bool IsInlier(const RansacShape& shape, FacetIndex index, float tol) const
+    {
+        const RansacFacet& face = data[index];
+        if (assigned[index] != 0) {
+            return false;
+        }
+        for (const auto& pnt : face.points) {
+            if (shape.Distance(pnt) > tol) {
+                return false;
+            }
+        }
+        return std::fabs(shape.Normal(face.center) * face.normal) >= minCosAngle;
+    }
+
+    std::vector<FacetIndex> Inliers(const RansacShape& shape, float tol) const
+    {
+        auto blocks =
+            parallel_blocks(remaining.size(), 10000, [&](std::size_t begin, std::size_t end) {
+                std::vector<FacetIndex> inliers;
+                for (std::size_t i = begin; i < end; i++) {
+                    if (IsInlier(shape, remaining[i], tol)) {
+                        inliers.push_back(remaining[i]);
+                    }
+                }
+                return inliers;
+            });
+
+        std::vector<FacetIndex> inliers;
+        for (const auto& it : blocks) {
+            inliers.insert(inliers.end(), it.begin(), it.end());
+        }
+        return inliers;
+    }
+
+    bool Refine(const std::vector<FacetIndex>& inliers, RansacShape& shape) const
+    {
+        // a least-squares fit doesn't need all points of a large shape
+        const std::size_t maxFacets = 10000;
+        std::size_t step = inliers.size() / maxFacets + 1;
+        std::vector<Base::Vector3f> points;
+        points.reserve(3 * (inliers.size() / step + 1));
+        for (std::size_t i = 0; i < inliers.size(); i += step) {
+            const RansacFacet& face = data[inliers[i]];
+            points.insert(points.end(), std::begin(face.points), std::end(face.points));
+        }
+
+        switch (shape.type) {
+            case RansacShapeType::Plane: {
+                PlaneFit fit;
+                fit.AddPoints(points);
+                if (fit.Fit() < FLOAT_MAX) {
+                    shape.base = fit.GetBase();
+                    shape.axis = fit.GetNormal();
+                    return true;
+                }
+            } break;
+            case RansacShapeType::Cylinder: {
+                CylinderFit fit;
+                fit.SetInitialValues(shape.base, shape.axis);
+                fit.AddPoints(points);
+                if (fit.Fit() < FLOAT_MAX) {
+                    shape.base = fit.GetBase();
+                    shape.axis = fit.GetAxis();
+                    shape.radius = fit.GetRadius();
+                    return true;
+                }
+            } break;
+            case RansacShapeType::Sphere: {
+                SphereFit fit;
+                fit.AddPoints(points);
+                if (fit.Fit() < FLOAT_MAX) {
+                    shape.base = fit.GetCenter();
+                    shape.radius = fit.GetRadius();
+                    return true;
+                }
+            } break;
+        }
+        return false;
+    }
+
+    std::vector<std::vector<FacetIndex>> Components(const std::vector<FacetIndex>& inliers) const
+    {
+        const MeshFacetArray& facets = kernel.GetFacets();
+        std::vector<char> marked(facets.size(), 0);
+        for (FacetIndex index : inliers) {
+            marked[index] = 1;
+        }
+
+        std::vector<std::vector<FacetIndex>> components;
+        for (FacetIndex index : inliers) {
+            if (marked[index] != 1) {
+                continue;
+            }
+            std::vector<FacetIndex> component {index};
+            marked[index] = 2;
+            for (std::size_t i = 0; i < component.size(); i++) {
+                for (FacetIndex neighbour : facets[component[i]]._aulNeighbours) {
+                    if (neighbour != FACET_INDEX_MAX && marked[neighbour] == 1) {
+                        marked[neighbour] = 2;
+                        component.push_back(neighbour);
+                    }
+                }
+            }
+            components.push_back(std::move(component));
+        }
+        return components;
+    }
+
+private:
+    const MeshKernel& kernel;
+    float minCosAngle;
+    float diagonal {0.0F};
+    std::mt19937 rng;
+    std::vector<RansacFacet> data;
+    std::vector<uint32_t> codes;
+    std::vector<std::pair<uint32_t, FacetIndex>> octree;
+    std::vector<char> assigned;
+    std::vector<FacetIndex> remaining;
+};
+}  // namespace
+
+void MeshRansacSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm)
+{
+    std::vector<RansacRequest> requests;
+    std::vector<MeshSurfaceSegmentPtr> others;
+    for (const auto& it : segm) {
+        auto surf = std::dynamic_pointer_cast<MeshDistanceSurfaceSegment>(it);
+        std::string type = it->GetType();
+        if (surf && type == "Plane") {
+            requests.push_back({surf.get(), RansacShapeType::Plane, surf->GetTolerance(), 0});
+        }
+        else if (surf && type == "Cylinder") {
+            requests.push_back({surf.get(), RansacShapeType::Cylinder, surf->GetTolerance(), 0});
+        }
+        else if (surf && type == "Sphere") {
+            requests.push_back({surf.get(), RansacShapeType::Sphere, surf->GetTolerance(), 0});
+        }
+        else {
+            others.push_back(it);
+            continue;
+        }
+        requests.back().minFacets = it->GetMinFacets();
+    }
+
+    if (!requests.empty() && myKernel.CountFacets() > 0) {
+        RansacDetector detector(myKernel, maxAngle, seed);
+        detector.Run(requests);
+    }
+
+    if (!others.empty()) {
+        MeshSegmentAlgorithm finder(myKernel);
+        finder.FindSegments(others);
+    }
+}
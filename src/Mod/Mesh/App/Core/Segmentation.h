@@ -64,6 +64,10 @@ public:
         return segments;
     }
     MeshSegment FindSegment(FacetIndex) const;
+    unsigned long GetMinFacets() const
+    {
+        return minFacets;
+    }
 
 private:
     std::vector<MeshSegment> segments;
@@ -81,6 +85,10 @@ public:
         , kernel(mesh)
         , tolerance(tol)
     {}
+    float GetTolerance() const
+    {
+        return tolerance;
+    }
 
 protected:
     // NOLINTBEGIN
@@ -396,6 +404,44 @@ private:
     const MeshKernel& myKernel;
 };
 
+/**
+ * Finds planes, cylinders and spheres with an efficient RANSAC approach instead of growing
+ * regions facet by facet. Candidate shapes are created from facets sampled in the same octree
+ * cell, scored in parallel on a random subset of the remaining facets, and the best candidate is
+ * refined with a least-squares fit and split into connected components.
+ * The segments are added to the passed distance segments of type Plane, Cylinder or Sphere using
+ * their tolerance and minimum number of facets. Other segments are handled by
+ * MeshSegmentAlgorithm.
+ */
+class MeshExport MeshRansacSegmentAlgorithm
+{
+public:
+    explicit MeshRansacSegmentAlgorithm(const MeshKernel& kernel)
+        : myKernel(kernel)
+    {}
+    /**
+     * Sets the maximum angle in radians between the normal of a facet and the normal of
+     * the surface at the facet's center. The default is 0.3.
+     */
+    void SetMaxNormalDeviation(float angle)
+    {
+        maxAngle = angle;
+    }
+    /**
+     * Sets the seed of the random generator. With the same seed the same segments are found.
+     */
+    void SetSeed(unsigned int value)
+    {
+        seed = value;
+    }
+    void FindSegments(std::vector<MeshSurfaceSegmentPtr>&);
+
+private:
+    const MeshKernel& myKernel;
+    float maxAngle {0.3F};
+    unsigned int seed {0};
+};
+
 }  // namespace MeshCore
 
 #endif  // MESHCORE_SEGMENTATION_H
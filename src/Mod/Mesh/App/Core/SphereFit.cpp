@@ -148,6 +148,7 @@ void SphereFit::ProjectToSphere()
             cPnt.z = (float)proj.z;
         }
     }
+    UpdateMoments();
 }
 
 // Compute approximations for the parameters using all points:
@@ -161,18 +162,12 @@ void SphereFit::ComputeApproximations()
     _vCenter.Set(0.0, 0.0, 0.0);
     _dRadius = 0.0;
     if (!_vPoints.empty()) {
-        std::list<Base::Vector3f>::const_iterator cIt;
-        for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
-            _vCenter.x += cIt->x;
-            _vCenter.y += cIt->y;
-            _vCenter.z += cIt->z;
-        }
-        _vCenter /= (double)_vPoints.size();
+        _vCenter = _moments.Mean();
 
-        for (cIt = _vPoints.begin(); cIt != _vPoints.end(); ++cIt) {
-            Base::Vector3d diff((double)cIt->x - _vCenter.x,
-                                (double)cIt->y - _vCenter.y,
-                                (double)cIt->z - _vCenter.z);
+        for (const auto& it : _vPoints) {
+            Base::Vector3d diff((double)it.x - _vCenter.x,
+                                (double)it.y - _vCenter.y,
+                                (double)it.z - _vCenter.z);
             _dRadius += diff.Length();
         }
         _dRadius /= (double)_vPoints.size();
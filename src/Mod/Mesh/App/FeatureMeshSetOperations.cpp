@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 
+#include "Core/Boolean.h"
 #include "Core/Iterator.h"
 #include "Core/SetOperations.h"
 
@@ -91,11 +92,11 @@ App::DocumentObjectExecReturn* SetOperations::execute()
                                    " or 'difference' or 'inner' or 'outer'");
         }
 
-        MeshCore::SetOperations setOp(meshKernel1.getKernel(),
-                                      meshKernel2.getKernel(),
-                                      pcKernel->getKernel(),
-                                      type,
-                                      1.0e-5F);
+        MeshCore::MeshBoolean setOp(meshKernel1.getKernel(),
+                                    meshKernel2.getKernel(),
+                                    pcKernel->getKernel(),
+                                    type,
+                                    1.0e-5F);
         setOp.Do();
         Mesh.setValuePtr(pcKernel.release());
     }
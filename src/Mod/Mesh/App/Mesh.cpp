@@ -38,6 +38,7 @@
 #include <Base/ViewProj.h>
 #include <Base/Writer.h>
 
+#include "Core/Boolean.h"
 #include "Core/Builder.h"
 #include "Core/Decimation.h"
 #include "Core/Degeneration.h"
@@ -1224,11 +1225,11 @@ MeshObject* MeshObject::unite(const MeshObject& mesh) const
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Union,
-                                  Epsilon);
+    MeshCore::MeshBoolean setOp(kernel1,
+                                kernel2,
+                                result,
+                                MeshCore::SetOperations::Union,
+                                Epsilon);
     setOp.Do();
     return new MeshObject(result);
 }
@@ -1240,11 +1241,11 @@ MeshObject* MeshObject::intersect(const MeshObject& mesh) const
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Intersect,
-                                  Epsilon);
+    MeshCore::MeshBoolean setOp(kernel1,
+                                kernel2,
+                                result,
+                                MeshCore::SetOperations::Intersect,
+                                Epsilon);
     setOp.Do();
     return new MeshObject(result);
 }
@@ -1256,11 +1257,11 @@ MeshObject* MeshObject::subtract(const MeshObject& mesh) const
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Difference,
-                                  Epsilon);
+    MeshCore::MeshBoolean setOp(kernel1,
+                                kernel2,
+                                result,
+                                MeshCore::SetOperations::Difference,
+                                Epsilon);
     setOp.Do();
     return new MeshObject(result);
 }
@@ -1272,11 +1273,11 @@ MeshObject* MeshObject::inner(const MeshObject& mesh) const
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Inner,
-                                  Epsilon);
+    MeshCore::MeshBoolean setOp(kernel1,
+                                kernel2,
+                                result,
+                                MeshCore::SetOperations::Inner,
+                                Epsilon);
     setOp.Do();
     return new MeshObject(result);
 }
@@ -1288,11 +1289,11 @@ MeshObject* MeshObject::outer(const MeshObject& mesh) const
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Outer,
-                                  Epsilon);
+    MeshCore::MeshBoolean setOp(kernel1,
+                                kernel2,
+                                result,
+                                MeshCore::SetOperations::Outer,
+                                Epsilon);
     setOp.Do();
     return new MeshObject(result);
 }
@@ -2078,14 +2079,14 @@ MeshObject* MeshObject::meshFromSegment(const std::vector<FacetIndex>& indices)
 
 std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type,
                                                    float dev,
-                                                   unsigned long minFacets) const
+                                                   unsigned long minFacets,
+                                                   SegmentMethod method) const
 {
     std::vector<Segment> segm;
     if (this->_kernel.CountFacets() == 0) {
         return segm;
     }
 
-    MeshCore::MeshSegmentAlgorithm finder(this->_kernel);
     std::shared_ptr<MeshCore::MeshDistanceSurfaceSegment> surf;
     switch (type) {
         case PLANE:
@@ -2116,7 +2117,14 @@ std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type
     if (surf.get()) {
         std::vector<MeshCore::MeshSurfaceSegmentPtr> surfaces;
         surfaces.push_back(surf);
-        finder.FindSegments(surfaces);
+        if (method == RANSAC) {
+            MeshCore::MeshRansacSegmentAlgorithm finder(this->_kernel);
+            finder.FindSegments(surfaces);
+        }
+        else {
+            MeshCore::MeshSegmentAlgorithm finder(this->_kernel);
+            finder.FindSegments(surfaces);
+        }
 
         const std::vector<MeshCore::MeshSegment>& data = surf->GetSegments();
         for (const auto& it : data) {
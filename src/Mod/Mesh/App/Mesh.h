@@ -100,6 +100,11 @@ public:
         INNER,
         OUTER
     };
+    enum SegmentMethod
+    {
+        REGIONGROWING,
+        RANSAC
+    };
 
     using TFacePair = std::pair<FacetIndex, FacetIndex>;
     using TFacePairs = std::vector<TFacePair>;
@@ -360,7 +365,10 @@ public:
     const Segment& getSegment(unsigned long) const;
     Segment& getSegment(unsigned long);
     MeshObject* meshFromSegment(const std::vector<FacetIndex>&) const;
-    std::vector<Segment> getSegmentsOfType(GeometryType, float dev, unsigned long minFacets) const;
+    std::vector<Segment> getSegmentsOfType(GeometryType,
+                                           float dev,
+                                           unsigned long minFacets,
+                                           SegmentMethod method = REGIONGROWING) const;
     //@}
 
     /** @name Primitives */
@@ -25,6 +25,7 @@
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/MatrixPy.h>
+#include <Base/PyBuffer.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
@@ -828,6 +829,101 @@ PyObject* MeshPy::addFacets(PyObject* args)
     return nullptr;
 }
 
+PyObject* MeshPy::getPointBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    try {
+        const MeshCore::MeshPointArray& points = getMeshObjectPtr()->getKernel().GetPoints();
+        Base::Matrix4D mat = getMeshObjectPtr()->getTransform();
+        float* data {};
+        Py::Object view =
+            Base::createMemoryView(static_cast<Py_ssize_t>(points.size()), 3, data);
+        for (const auto& pnt : points) {
+            Base::Vector3d vec = mat * Base::Vector3d(pnt.x, pnt.y, pnt.z);
+            *data++ = static_cast<float>(vec.x);
+            *data++ = static_cast<float>(vec.y);
+            *data++ = static_cast<float>(vec.z);
+        }
+        return Py::new_reference_to(view);
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+}
+
+PyObject* MeshPy::getFacetBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    try {
+        const MeshCore::MeshFacetArray& facets = getMeshObjectPtr()->getKernel().GetFacets();
+        std::uint32_t* data {};
+        Py::Object view =
+            Base::createMemoryView(static_cast<Py_ssize_t>(facets.size()), 3, data);
+        for (const auto& face : facets) {
+            *data++ = static_cast<std::uint32_t>(face._aulPoints[0]);
+            *data++ = static_cast<std::uint32_t>(face._aulPoints[1]);
+            *data++ = static_cast<std::uint32_t>(face._aulPoints[2]);
+        }
+        return Py::new_reference_to(view);
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+}
+
+PyObject* MeshPy::setFromBuffers(PyObject* args)
+{
+    PyObject* pnts {};
+    PyObject* faces {};
+    if (!PyArg_ParseTuple(args, "OO", &pnts, &faces)) {
+        return nullptr;
+    }
+
+    try {
+        std::vector<double> coords = Base::readFloatBuffer(pnts, 3);
+        std::vector<unsigned long> indices = Base::readIndexBuffer(faces, 3);
+
+        // the coordinates are global like the ones of getPointBuffer()
+        Base::Matrix4D mat = getMeshObjectPtr()->getTransform();
+        mat.inverseGauss();
+
+        MeshCore::MeshPointArray points;
+        points.reserve(coords.size() / 3);
+        for (std::size_t i = 0; i < coords.size(); i += 3) {
+            Base::Vector3d vec = mat * Base::Vector3d(coords[i], coords[i + 1], coords[i + 2]);
+            points.push_back(Base::convertTo<Base::Vector3f>(vec));
+        }
+
+        MeshCore::MeshFacetArray facets;
+        facets.reserve(indices.size() / 3);
+        for (std::size_t i = 0; i < indices.size(); i += 3) {
+            MeshCore::MeshFacet face;
+            for (std::size_t j = 0; j < 3; j++) {
+                if (indices[i + j] >= points.size()) {
+                    throw Py::IndexError("point index out of range");
+                }
+                face._aulPoints[j] = indices[i + j];
+            }
+            facets.push_back(face);
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets, true);
+        getMeshObjectPtr()->swap(kernel);
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+
+    Py_Return;
+}
+
 PyObject* MeshPy::removeFacets(PyObject* args)
 {
     PyObject* list {};
@@ -2148,7 +2244,17 @@ PyObject* MeshPy::getSegmentsOfType(PyObject* args)
     char* type {};
     float dev {};
     unsigned long minFacets = 0;
-    if (!PyArg_ParseTuple(args, "sf|k", &type, &dev, &minFacets)) {
+    char* method = nullptr;
+    if (!PyArg_ParseTuple(args, "sf|ks", &type, &dev, &minFacets, &method)) {
+        return nullptr;
+    }
+
+    Mesh::MeshObject::SegmentMethod segmMethod = Mesh::MeshObject::REGIONGROWING;
+    if (method && strcmp(method, "Ransac") == 0) {
+        segmMethod = Mesh::MeshObject::RANSAC;
+    }
+    else if (method && strcmp(method, "RegionGrowing") != 0) {
+        PyErr_SetString(PyExc_ValueError, "Unsupported method");
         return nullptr;
     }
 
@@ -2168,7 +2274,8 @@ PyObject* MeshPy::getSegmentsOfType(PyObject* args)
     }
 
     Mesh::MeshObject* mesh = getMeshObjectPtr();
-    std::vector<Mesh::Segment> segments = mesh->getSegmentsOfType(geoType, dev, minFacets);
+    std::vector<Mesh::Segment> segments =
+        mesh->getSegmentsOfType(geoType, dev, minFacets, segmMethod);
 
     Py::List s;
     for (const auto& segment : segments) {
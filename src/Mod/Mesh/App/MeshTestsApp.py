@@ -704,6 +704,43 @@ class MeshSubElement(unittest.TestCase):
         self.assertEqual(segment.CountPoints, 7)
         self.assertEqual(segment.CountFacets, 5)
 
+    def testBuffers(self):
+        points = self.mesh.getPointBuffer()
+        facets = self.mesh.getFacetBuffer()
+        self.assertEqual(points.format, "f")
+        self.assertEqual(points.shape, (8, 3))
+        self.assertEqual(facets.format, "I")
+        self.assertEqual(facets.shape, (12, 3))
+        self.assertEqual(points[0, 0], self.mesh.Points[0].x)
+        self.assertEqual(list(facets[5]), list(self.mesh.Topology[1][5]))
+
+        mesh = Mesh.Mesh()
+        mesh.setFromBuffers(points, facets)
+        self.assertEqual(mesh.CountPoints, 8)
+        self.assertEqual(mesh.CountFacets, 12)
+        self.assertAlmostEqual(mesh.Volume, self.mesh.Volume)
+        with self.assertRaises(IndexError):
+            mesh.setFromBuffers(points, memoryview(bytes([0, 1, 8])))
+
+    def testBuffersWithPlacement(self):
+        mesh = self.mesh.copy()
+        mesh.addSegment([0, 1])
+        mesh.Placement = FreeCAD.Placement(
+            Base.Vector(10, 20, 30), FreeCAD.Rotation(Base.Vector(0, 0, 1), 90)
+        )
+        points = mesh.getPointBuffer()
+        for i, pnt in enumerate(mesh.Points):
+            buffered = Base.Vector(points[i, 0], points[i, 1], points[i, 2])
+            self.assertTrue(buffered.isEqual(pnt.Vector, 1e-5))
+
+        # the buffer coordinates are global, the placement is kept
+        placement = mesh.Placement
+        mesh.setFromBuffers(points, mesh.getFacetBuffer())
+        self.assertEqual(mesh.Placement, placement)
+        self.assertEqual(mesh.countSegments(), 0)
+        for pnt, other in zip(mesh.Points, self.mesh.Points):
+            self.assertTrue(pnt.Vector.isEqual(placement.multVec(other.Vector), 1e-5))
+
     def tearDown(self):
         pass
 
@@ -0,0 +1,65 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+import os
+import tempfile
+import time
+import unittest
+
+import FreeCAD
+import FreeCADGui
+import Mesh
+
+# ---------------------------------------------------------------------------
+# define the functions to test the FreeCAD mesh rendering
+# ---------------------------------------------------------------------------
+
+
+class MeshRenderTestCases(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("MeshRenderTest")
+        feature = self.doc.addObject("Mesh::Feature", "Sphere")
+        feature.Mesh = Mesh.createSphere(10.0, 500)
+        self.doc.recompute()
+        self.triangles = feature.Mesh.CountFacets
+        self.view = FreeCADGui.getDocument(self.doc.Name).ActiveView
+        self.view.viewIsometric()
+        self.view.fitAll()
+
+    def renderFrame(self):
+        start = time.perf_counter()
+        image = self.view.getViewer().grabFramebuffer()
+        elapsed = time.perf_counter() - start
+        self.assertFalse(image.isNull())
+        return elapsed
+
+    def testFrameTime(self):
+        # the first frame creates and uploads the buffers
+        first = self.renderFrame()
+
+        frames = []
+        for i in range(20):
+            rotation = FreeCAD.Rotation(FreeCAD.Vector(0, 0, 1), 18 * i)
+            self.view.setCameraOrientation(rotation)
+            frames.append(self.renderFrame())
+        frames.sort()
+
+        # an offscreen image is rendered in a further context
+        with tempfile.TemporaryDirectory() as tmpdir:
+            start = time.perf_counter()
+            self.view.saveImage(os.path.join(tmpdir, "sphere.png"), 400, 300)
+            offscreen = time.perf_counter() - start
+        after = self.renderFrame()
+
+        FreeCAD.Console.PrintMessage(
+            "Mesh frame times for {} triangles: first {:.1f} ms, median {:.1f} ms, "
+            "offscreen {:.1f} ms, after offscreen {:.1f} ms\n".format(
+                self.triangles,
+                1000 * first,
+                1000 * frames[len(frames) // 2],
+                1000 * offscreen,
+                1000 * after,
+            )
+        )
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
@@ -447,8 +447,6 @@ void SegmentationBestFit::accept()
     const Mesh::MeshObject* mesh = myMesh->Mesh.getValuePtr();
     const MeshCore::MeshKernel& kernel = mesh->getKernel();
 
-    MeshCore::MeshSegmentAlgorithm finder(kernel);
-
     std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
     if (ui->groupBoxCyl->isChecked()) {
         MeshCore::AbstractSurfaceFit* fitter {};
@@ -498,7 +496,14 @@ void SegmentationBestFit::accept()
                                                                              ui->numPln->value(),
                                                                              ui->tolPln->value()));
     }
-    finder.FindSegments(segm);
+    if (ui->checkRansac->isChecked()) {
+        MeshCore::MeshRansacSegmentAlgorithm finder(kernel);
+        finder.FindSegments(segm);
+    }
+    else {
+        MeshCore::MeshSegmentAlgorithm finder(kernel);
+        finder.FindSegments(segm);
+    }
 
     App::Document* document = App::GetApplication().getActiveDocument();
     document->openTransaction("Segmentation");
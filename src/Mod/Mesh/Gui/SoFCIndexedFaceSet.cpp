@@ -30,7 +30,13 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <climits>
+#include <cmath>
+#include <future>
+#include <set>
+#include <unordered_map>
 #ifdef FC_OS_MACOSX
 #include <OpenGL/gl.h>
 #include <OpenGL/glext.h>
@@ -40,6 +46,7 @@
 #include <GL/glext.h>
 #include <GL/glu.h>
 #endif
+#include <Inventor/SbBox3f.h>
 #include <Inventor/actions/SoGLRenderAction.h>
 #include <Inventor/actions/SoSearchAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
@@ -60,6 +67,7 @@
 #include <Gui/GLBuffer.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
+#include <Mod/Mesh/App/Core/Functional.h>
 
 #include "SoFCIndexedFaceSet.h"
 
@@ -75,30 +83,91 @@ class MeshRenderer::Private
 public:
     Gui::OpenGLMultiBuffer vertices;
     Gui::OpenGLMultiBuffer indices;
+    Gui::OpenGLMultiBuffer proxyVertices;
+    Gui::OpenGLMultiBuffer proxyIndices;
     const SbColor* pcolors {nullptr};
     SoMaterialBindingElement::Binding matbinding {SoMaterialBindingElement::OVERALL};
-    bool initialized {false};
 
     Private();
+    ~Private();
     bool canRenderGLArray(SoGLRenderAction*) const;
     void generateGLArrays(SoGLRenderAction* action,
                           SoMaterialBindingElement::Binding matbind,
                           std::vector<float>& vertex,
                           std::vector<int32_t>& index);
+    bool updateColors(SoGLRenderAction* action,
+                      SoMaterialBindingElement::Binding matbind,
+                      const SbColor* colors,
+                      const int32_t* colorIndex,
+                      float transparency);
     void renderFacesGLArray(SoGLRenderAction*);
     void renderCoordsGLArray(SoGLRenderAction*);
+    bool renderProxyGLArray(SoGLRenderAction*, unsigned int triangleLimit);
+    void prepareProxy(unsigned int triangleLimit);
     void update();
     bool needUpdate(SoGLRenderAction*);
 
 private:
+    struct Proxy
+    {
+        std::vector<float> vertex;
+        std::vector<int32_t> index;
+    };
+
+    std::size_t stride() const;
+    bool keepArrays() const;
+    bool isUploaded(uint32_t context) const;
+    void upload(uint32_t context);
+    void releaseArrays();
     void renderGLArray(SoGLRenderAction*, GLenum);
+    void renderBuffers(Gui::OpenGLMultiBuffer& vbuf,
+                       Gui::OpenGLMultiBuffer& ibuf,
+                       std::size_t count,
+                       GLenum mode);
+    void startProxy(unsigned int triangleLimit);
+    void resetProxy();
+    static Proxy createProxy(const std::vector<float>& vertex,
+                             const std::vector<int32_t>& index,
+                             std::size_t stride,
+                             unsigned int triangleLimit,
+                             const std::atomic<bool>& abort);
+
+private:
+    // The arrays are only kept to update the colors in place. Otherwise they are
+    // released once uploaded and rebuilt from the nodes when a further context
+    // or the proxy needs them.
+    std::vector<float> vertexArray;
+    std::vector<int32_t> indexArray;
+    std::size_t indexCount {0};
+    bool released {false};
+    std::set<uint32_t> contexts;
+    // contexts whose buffers miss a partial update
+    std::set<uint32_t> outdated;
+    // set once the arrays are generated, even if the mesh is empty
+    bool initialized {false};
+    // triangle limit of a proxy waiting for the arrays to be rebuilt
+    unsigned int pendingProxyLimit {0};
+
+    // The proxy is a decimated copy of the mesh that is rendered during
+    // navigation. It's created in a worker thread from the cached arrays.
+    Proxy proxy;
+    std::future<Proxy> proxyFuture;
+    std::atomic<bool> abortProxy {false};
+    unsigned int proxyLimit {0};
 };
 
 MeshRenderer::Private::Private()
     : vertices(GL_ARRAY_BUFFER)
     , indices(GL_ELEMENT_ARRAY_BUFFER)
+    , proxyVertices(GL_ARRAY_BUFFER)
+    , proxyIndices(GL_ELEMENT_ARRAY_BUFFER)
 {}
 
+MeshRenderer::Private::~Private()
+{
+    resetProxy();
+}
+
 bool MeshRenderer::Private::canRenderGLArray(SoGLRenderAction* action) const
 {
     static bool init = false;
@@ -115,31 +184,160 @@ bool MeshRenderer::Private::canRenderGLArray(SoGLRenderAction* action) const
     return vboAvailable;
 }
 
+std::size_t MeshRenderer::Private::stride() const
+{
+    // GL_C4F_N3F_V3F or GL_N3F_V3F
+    return matbinding != SoMaterialBindingElement::OVERALL ? 10 : 6;
+}
+
+bool MeshRenderer::Private::keepArrays() const
+{
+    // only the colors are updated in place
+    return matbinding != SoMaterialBindingElement::OVERALL;
+}
+
+bool MeshRenderer::Private::isUploaded(uint32_t context) const
+{
+    return vertices.isCreated(context) && indices.isCreated(context)
+        && outdated.count(context) == 0;
+}
+
 void MeshRenderer::Private::generateGLArrays(SoGLRenderAction* action,
                                              SoMaterialBindingElement::Binding matbind,
                                              std::vector<float>& vertex,
                                              std::vector<int32_t>& index)
 {
+    // Released arrays of an unchanged mesh are rebuilt for a further context or
+    // the proxy, the buffers of the other contexts stay valid
+    unsigned int proxyRequest = pendingProxyLimit;
+    if (!released || matbind != matbinding) {
+        update();
+    }
+    initialized = true;
+    released = false;
     if (vertex.empty() || index.empty()) {
         return;
     }
 
+    vertexArray.swap(vertex);
+    indexArray.swap(index);
+    indexCount = indexArray.size();
+    this->matbinding = matbind;
+
+    uint32_t context = action->getCacheContext();
+    if (!isUploaded(context)) {
+        upload(context);
+    }
+    pendingProxyLimit = 0;
+    if (proxyRequest > 0) {
+        startProxy(proxyRequest);
+    }
+    releaseArrays();
+}
+
+void MeshRenderer::Private::upload(uint32_t context)
+{
     // lazy initialization
-    vertices.setCurrentContext(action->getCacheContext());
-    indices.setCurrentContext(action->getCacheContext());
+    vertices.setCurrentContext(context);
+    indices.setCurrentContext(context);
 
-    initialized = true;
     vertices.create();
     indices.create();
 
     vertices.bind();
-    vertices.allocate(vertex.data(), vertex.size() * sizeof(float));
+    vertices.allocate(vertexArray.data(), vertexArray.size() * sizeof(float));
     vertices.release();
 
     indices.bind();
-    indices.allocate(index.data(), index.size() * sizeof(int32_t));
+    indices.allocate(indexArray.data(), indexArray.size() * sizeof(int32_t));
     indices.release();
-    this->matbinding = matbind;
+
+    contexts.insert(context);
+    outdated.erase(context);
+}
+
+void MeshRenderer::Private::releaseArrays()
+{
+    if (keepArrays() || released) {
+        return;
+    }
+
+    // swap to free the memory, clear() keeps the capacity
+    std::vector<float>().swap(vertexArray);
+    std::vector<int32_t>().swap(indexArray);
+    released = true;
+}
+
+bool MeshRenderer::Private::updateColors(SoGLRenderAction* action,
+                                         SoMaterialBindingElement::Binding matbind,
+                                         const SbColor* colors,
+                                         const int32_t* colorIndex,
+                                         float transparency)
+{
+    if (matbind == SoMaterialBindingElement::OVERALL || matbind != matbinding
+        || vertexArray.empty() || !colors) {
+        return false;
+    }
+
+    // the proxy reads the cached arrays
+    resetProxy();
+
+    // Compare the colors with the cached ones and collect the ranges of
+    // changed vertices. Ranges with small gaps are merged to reduce the
+    // number of buffer updates.
+    const std::size_t gap = 256;
+    std::size_t numVertices = vertexArray.size() / 10;
+    auto blocks = MeshCore::parallel_blocks(
+        numVertices,
+        100000,
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<std::pair<std::size_t, std::size_t>> ranges;
+            for (std::size_t i = begin; i < end; i++) {
+                // the color indices are separated by -1 after each triangle
+                const SbColor& c = colors[colorIndex ? colorIndex[i + i / 3] : i / 3];
+                float* rgba = &vertexArray[10 * i];
+                if (rgba[0] == c[0] && rgba[1] == c[1] && rgba[2] == c[2]
+                    && rgba[3] == transparency) {
+                    continue;
+                }
+                rgba[0] = c[0];
+                rgba[1] = c[1];
+                rgba[2] = c[2];
+                rgba[3] = transparency;
+                if (!ranges.empty() && i - ranges.back().second < gap) {
+                    ranges.back().second = i + 1;
+                }
+                else {
+                    ranges.emplace_back(i, i + 1);
+                }
+            }
+            return ranges;
+        });
+
+    // the buffers of the other contexts are uploaded completely when needed
+    uint32_t context = action->getCacheContext();
+    for (uint32_t it : contexts) {
+        if (it != context) {
+            outdated.insert(it);
+        }
+    }
+
+    if (vertices.isCreated(context) && outdated.count(context) == 0) {
+        vertices.setCurrentContext(context);
+        vertices.bind();
+        for (const auto& block : blocks) {
+            for (const auto& it : block) {
+                std::size_t offset = 10 * it.first;
+                std::size_t count = 10 * (it.second - it.first);
+                vertices.write(offset * sizeof(float),
+                               &vertexArray[offset],
+                               count * sizeof(float));
+            }
+        }
+        vertices.release();
+    }
+
+    return true;
 }
 
 void MeshRenderer::Private::renderGLArray(SoGLRenderAction* action, GLenum mode)
@@ -148,16 +346,37 @@ void MeshRenderer::Private::renderGLArray(SoGLRenderAction* action, GLenum mode)
         SoDebugError::postWarning("MeshRenderer", "not initialized");
         return;
     }
+    if (indexCount == 0) {
+        return;
+    }
 
-    vertices.setCurrentContext(action->getCacheContext());
-    indices.setCurrentContext(action->getCacheContext());
+    uint32_t context = action->getCacheContext();
+    if (!isUploaded(context)) {
+        // needUpdate() has the released arrays rebuilt before rendering
+        if (released) {
+            return;
+        }
+        upload(context);
+    }
+    else {
+        vertices.setCurrentContext(context);
+        indices.setCurrentContext(context);
+    }
+
+    renderBuffers(vertices, indices, indexCount, mode);
+}
 
+void MeshRenderer::Private::renderBuffers(Gui::OpenGLMultiBuffer& vbuf,
+                                          Gui::OpenGLMultiBuffer& ibuf,
+                                          std::size_t count,
+                                          GLenum mode)
+{
     glEnableClientState(GL_VERTEX_ARRAY);
     glEnableClientState(GL_NORMAL_ARRAY);
     glEnableClientState(GL_COLOR_ARRAY);
 
-    vertices.bind();
-    indices.bind();
+    vbuf.bind();
+    ibuf.bind();
 
     if (matbinding != SoMaterialBindingElement::OVERALL) {
         glInterleavedArrays(GL_C4F_N3F_V3F, 0, nullptr);
@@ -166,10 +385,10 @@ void MeshRenderer::Private::renderGLArray(SoGLRenderAction* action, GLenum mode)
         glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
     }
 
-    glDrawElements(mode, indices.size() / sizeof(uint32_t), GL_UNSIGNED_INT, nullptr);
+    glDrawElements(mode, static_cast<GLsizei>(count), GL_UNSIGNED_INT, nullptr);
 
-    vertices.release();
-    indices.release();
+    vbuf.release();
+    ibuf.release();
 
     glDisableClientState(GL_COLOR_ARRAY);
     glDisableClientState(GL_NORMAL_ARRAY);
@@ -186,16 +405,225 @@ void MeshRenderer::Private::renderCoordsGLArray(SoGLRenderAction* action)
     renderGLArray(action, GL_POINTS);
 }
 
+bool MeshRenderer::Private::renderProxyGLArray(SoGLRenderAction* action,
+                                               unsigned int triangleLimit)
+{
+    if (indexCount == 0) {
+        return false;
+    }
+
+    // the full mesh is rendered until the proxy is ready
+    if (proxyLimit != triangleLimit) {
+        if (released) {
+            // needUpdate() has the arrays rebuilt in the next render pass
+            pendingProxyLimit = triangleLimit;
+        }
+        else {
+            startProxy(triangleLimit);
+        }
+        return false;
+    }
+    if (proxyFuture.valid()) {
+        if (proxyFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        proxy = proxyFuture.get();
+    }
+    if (proxy.index.empty()) {
+        return false;
+    }
+
+    uint32_t context = action->getCacheContext();
+    proxyVertices.setCurrentContext(context);
+    proxyIndices.setCurrentContext(context);
+    if (!proxyVertices.isCreated(context) || !proxyIndices.isCreated(context)) {
+        proxyVertices.create();
+        proxyIndices.create();
+
+        proxyVertices.bind();
+        proxyVertices.allocate(proxy.vertex.data(), proxy.vertex.size() * sizeof(float));
+        proxyVertices.release();
+
+        proxyIndices.bind();
+        proxyIndices.allocate(proxy.index.data(), proxy.index.size() * sizeof(int32_t));
+        proxyIndices.release();
+    }
+
+    renderBuffers(proxyVertices, proxyIndices, proxy.index.size(), GL_TRIANGLES);
+    return true;
+}
+
+void MeshRenderer::Private::prepareProxy(unsigned int triangleLimit)
+{
+    pendingProxyLimit = triangleLimit;
+}
+
+void MeshRenderer::Private::startProxy(unsigned int triangleLimit)
+{
+    resetProxy();
+    proxyLimit = triangleLimit;
+    std::size_t size = stride();
+    if (keepArrays()) {
+        proxyFuture = std::async(std::launch::async, [this, size, triangleLimit]() {
+            return createProxy(vertexArray, indexArray, size, triangleLimit, abortProxy);
+        });
+    }
+    else {
+        // the worker takes over the arrays that would be released anyway
+        proxyFuture = std::async(std::launch::async,
+                                 [this,
+                                  vertex = std::move(vertexArray),
+                                  index = std::move(indexArray),
+                                  size,
+                                  triangleLimit]() {
+                                     return createProxy(vertex,
+                                                        index,
+                                                        size,
+                                                        triangleLimit,
+                                                        abortProxy);
+                                 });
+        vertexArray.clear();
+        indexArray.clear();
+        released = true;
+    }
+}
+
+void MeshRenderer::Private::resetProxy()
+{
+    if (proxyFuture.valid()) {
+        abortProxy = true;
+        proxyFuture.wait();
+        proxyFuture = {};
+        abortProxy = false;
+    }
+
+    proxy = {};
+    proxyLimit = 0;
+    proxyVertices.destroy();
+    proxyIndices.destroy();
+}
+
+/**
+ * Decimates the mesh by clustering its vertices in a regular grid. The
+ * vertices of a cell are averaged and triangles that collapse are removed.
+ * The grid is chosen so that the proxy has roughly \a triangleLimit triangles.
+ */
+MeshRenderer::Private::Proxy
+MeshRenderer::Private::createProxy(const std::vector<float>& vertex,
+                                   const std::vector<int32_t>& index,
+                                   std::size_t stride,
+                                   unsigned int triangleLimit,
+                                   const std::atomic<bool>& abort)
+{
+    // the normal and the point are at the end of the interleaved vertex
+    const std::size_t normalOffset = stride - 6;
+    const std::size_t pointOffset = stride - 3;
+    const std::size_t numVertices = vertex.size() / stride;
+
+    SbBox3f box;
+    for (std::size_t i = 0; i < numVertices; i++) {
+        box.extendBy(SbVec3f(&vertex[i * stride + pointOffset]));
+    }
+    if (box.isEmpty()) {
+        return {};
+    }
+
+    // a box of n x n x n cells has about 6 n^2 cells on its surface with
+    // two triangles each
+    float dx {}, dy {}, dz {};
+    box.getSize(dx, dy, dz);
+    float cells = std::max(1.0F, std::sqrt(float(triangleLimit) / 12.0F));
+    float cellSize = std::max({dx, dy, dz}) / cells;
+    if (cellSize <= 0.0F) {
+        return {};
+    }
+
+    Proxy proxy;
+    const SbVec3f& minPnt = box.getMin();
+    std::unordered_map<uint64_t, int32_t> cellToCluster;
+    std::vector<int32_t> vertexToCluster(numVertices);
+    std::vector<float> weights;
+    for (std::size_t i = 0; i < numVertices; i++) {
+        if (i % 65536 == 0 && abort) {
+            return {};
+        }
+
+        const float* data = &vertex[i * stride];
+        const float* pnt = data + pointOffset;
+        auto x = static_cast<uint64_t>((pnt[0] - minPnt[0]) / cellSize);
+        auto y = static_cast<uint64_t>((pnt[1] - minPnt[1]) / cellSize);
+        auto z = static_cast<uint64_t>((pnt[2] - minPnt[2]) / cellSize);
+        uint64_t key = x | (y << 21) | (z << 42);
+
+        auto it = cellToCluster.emplace(key, static_cast<int32_t>(weights.size())).first;
+        int32_t cluster = it->second;
+        if (cluster == static_cast<int32_t>(weights.size())) {
+            weights.push_back(0.0F);
+            proxy.vertex.resize(proxy.vertex.size() + stride);
+        }
+
+        float* sum = &proxy.vertex[cluster * stride];
+        for (std::size_t j = 0; j < stride; j++) {
+            sum[j] += data[j];
+        }
+        weights[cluster] += 1.0F;
+        vertexToCluster[i] = cluster;
+    }
+
+    for (std::size_t i = 0; i < weights.size(); i++) {
+        float* data = &proxy.vertex[i * stride];
+        for (std::size_t j = 0; j < stride; j++) {
+            data[j] /= weights[i];
+        }
+        SbVec3f normal(data + normalOffset);
+        float length = normal.length();
+        if (length > 0.0F) {
+            data[normalOffset] = normal[0] / length;
+            data[normalOffset + 1] = normal[1] / length;
+            data[normalOffset + 2] = normal[2] / length;
+        }
+    }
+
+    for (std::size_t i = 0; i + 2 < index.size(); i += 3) {
+        int32_t c1 = vertexToCluster[index[i]];
+        int32_t c2 = vertexToCluster[index[i + 1]];
+        int32_t c3 = vertexToCluster[index[i + 2]];
+        if (c1 != c2 && c2 != c3 && c3 != c1) {
+            proxy.index.push_back(c1);
+            proxy.index.push_back(c2);
+            proxy.index.push_back(c3);
+        }
+    }
+
+    return proxy;
+}
+
 void MeshRenderer::Private::update()
 {
+    resetProxy();
+    std::vector<float>().swap(vertexArray);
+    std::vector<int32_t>().swap(indexArray);
+    indexCount = 0;
+    released = false;
+    pendingProxyLimit = 0;
+    contexts.clear();
+    outdated.clear();
     vertices.destroy();
     indices.destroy();
+    initialized = false;
 }
 
 bool MeshRenderer::Private::needUpdate(SoGLRenderAction* action)
 {
-    return !vertices.isCreated(action->getCacheContext())
-        || !indices.isCreated(action->getCacheContext());
+    if (!initialized) {
+        return true;
+    }
+    // the buffers of further contexts are uploaded from the cached arrays,
+    // released arrays must be rebuilt from the nodes
+    if (!released) {
+        return false;
+    }
+    return pendingProxyLimit > 0 || !isUploaded(action->getCacheContext());
 }
 #elif defined RENDER_GLARRAYS
 class MeshRenderer::Private
@@ -216,8 +644,22 @@ public:
                           SoMaterialBindingElement::Binding matbind,
                           std::vector<float>& vertex,
                           std::vector<int32_t>& index);
+    bool updateColors(SoGLRenderAction*,
+                      SoMaterialBindingElement::Binding,
+                      const SbColor*,
+                      const int32_t*,
+                      float)
+    {
+        return false;
+    }
     void renderFacesGLArray(SoGLRenderAction* action);
     void renderCoordsGLArray(SoGLRenderAction* action);
+    bool renderProxyGLArray(SoGLRenderAction*, unsigned int)
+    {
+        return false;
+    }
+    void prepareProxy(unsigned int)
+    {}
     void update()
     {}
     bool needUpdate(SoGLRenderAction*)
@@ -307,10 +749,24 @@ public:
                           std::vector<float>&,
                           std::vector<int32_t>&)
     {}
+    bool updateColors(SoGLRenderAction*,
+                      SoMaterialBindingElement::Binding,
+                      const SbColor*,
+                      const int32_t*,
+                      float)
+    {
+        return false;
+    }
     void renderFacesGLArray(SoGLRenderAction*)
     {}
     void renderCoordsGLArray(SoGLRenderAction*)
     {}
+    bool renderProxyGLArray(SoGLRenderAction*, unsigned int)
+    {
+        return false;
+    }
+    void prepareProxy(unsigned int)
+    {}
     void update()
     {}
     bool needUpdate(SoGLRenderAction*)
@@ -351,6 +807,24 @@ void MeshRenderer::generateGLArrays(SoGLRenderAction* action,
     p->generateGLArrays(action, matbind, vertex, index);
 }
 
+/**
+ * Writes the changed colors into the buffers. \a colorIndex has the layout of
+ * the coordinate indices and may be null if there is a color per face.
+ * Returns false if the buffers don't have the layout of \a matbind.
+ */
+bool MeshRenderer::updateColors(SoGLRenderAction* action,
+                                SoMaterialBindingElement::Binding matbind,
+                                const SbColor* colors,
+                                const int32_t* colorIndex,
+                                float transparency)
+{
+    if (!p->updateColors(action, matbind, colors, colorIndex, transparency)) {
+        return false;
+    }
+    p->pcolors = colors;
+    return true;
+}
+
 // Implementation                            | FPS
 // ================================================
 // drawCoords (every 4th vertex)             | 20.0
@@ -381,6 +855,24 @@ void MeshRenderer::renderFacesGLArray(SoGLRenderAction* action)
     p->renderFacesGLArray(action);
 }
 
+/**
+ * Renders a decimated proxy of about \a triangleLimit triangles. The proxy is
+ * created in a worker thread and false is returned until it's ready.
+ */
+bool MeshRenderer::renderProxyGLArray(SoGLRenderAction* action, unsigned int triangleLimit)
+{
+    return p->renderProxyGLArray(action, triangleLimit);
+}
+
+/**
+ * Creates the proxy of about \a triangleLimit triangles from the next generated
+ * arrays, so that they don't need to be rebuilt once navigation starts.
+ */
+void MeshRenderer::prepareProxy(unsigned int triangleLimit)
+{
+    p->prepareProxy(triangleLimit);
+}
+
 bool MeshRenderer::canRenderGLArray(SoGLRenderAction* action) const
 {
     return p->canRenderGLArray(action);
@@ -504,8 +996,12 @@ void SoFCIndexedFaceSet::GLRender(SoGLRenderAction* action)
     if (useVBO) {
         if (updateGLArray.getValue()) {
             updateGLArray.setValue(false);
-            render.update();
-            generateGLArrays(action);
+            // invalidate() resets the buffers if the geometry has changed,
+            // otherwise only the colors are updated
+            if (render.needUpdate(action) || !updateGLArrayColors(action)) {
+                render.update();
+                generateGLArrays(action);
+            }
         }
         else if (render.needUpdate(action)) {
             generateGLArrays(action);
@@ -514,7 +1010,13 @@ void SoFCIndexedFaceSet::GLRender(SoGLRenderAction* action)
         if (render.matchMaterial(state)) {
             SoMaterialBundle mb(action);
             mb.sendFirst();
-            render.renderFacesGLArray(action);
+            // render a decimated proxy of huge meshes during navigation
+            SbBool mode = Gui::SoFCInteractiveElement::get(state);
+            unsigned int num = this->coordIndex.getNum() / 4;
+            if (!mode || num <= this->renderTriangleLimit
+                || !render.renderProxyGLArray(action, this->renderTriangleLimit)) {
+                render.renderFacesGLArray(action);
+            }
         }
         else {
             drawFaces(action);
@@ -715,9 +1217,54 @@ void SoFCIndexedFaceSet::drawCoords(const SoGLCoordinateElement* const vertexlis
 
 void SoFCIndexedFaceSet::invalidate()
 {
+    render.update();
     updateGLArray.setValue(true);
 }
 
+/**
+ * Updates the colors of the existing buffers after a material change.
+ * Returns false if the buffers must be regenerated.
+ */
+bool SoFCIndexedFaceSet::updateGLArrayColors(SoGLRenderAction* action)
+{
+    SoState* state = action->getState();
+    SoGLLazyElement* gl = SoGLLazyElement::getInstance(state);
+    if (!gl) {
+        return false;
+    }
+
+    const SbColor* pcolors = gl->getDiffusePointer();
+    int numcolors = gl->getNumDiffuse();
+    const float* transp = gl->getTransparencyPointer();
+    float t = transp ? transp[0] : 0;
+
+    const int32_t* mindices = nullptr;
+    SoMaterialBindingElement::Binding matbind = SoMaterialBindingElement::get(state);
+    if (matbind == SoMaterialBindingElement::PER_FACE) {
+        if (numcolors != this->coordIndex.getNum() / 4) {
+            return false;
+        }
+    }
+    else if (matbind == SoMaterialBindingElement::PER_VERTEX_INDEXED) {
+        if (numcolors != SoCoordinateElement::getInstance(state)->getNum()) {
+            return false;
+        }
+        // like SoIndexedShape::getVertexData() use the coordinate indices
+        // if there are no material indices
+        if (this->materialIndex.getNum() > 0 && this->materialIndex[0] >= 0) {
+            mindices = this->materialIndex.getValues(0);
+        }
+        else {
+            mindices = this->coordIndex.getValues(0);
+        }
+    }
+    else {
+        return false;
+    }
+
+    return render.updateColors(action, matbind, pcolors, mindices, t);
+}
+
 void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
 {
     const SoCoordinateElement* coords = nullptr;
@@ -766,11 +1313,37 @@ void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
         mindices = cindices;
     }
 
+    // The arrays of huge meshes are filled in parallel. Each triangle has four
+    // coordinate indices because they are separated by -1.
+    auto fillTriangles = [&](std::size_t stride, auto&& fillVertex) {
+        MeshCore::parallel_blocks(numTria, 10000, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                for (std::size_t j = 0; j < 3; j++) {
+                    std::size_t vertex = 3 * i + j;
+                    fillVertex(&face_vertices[stride * vertex], i, 4 * i + j);
+                    face_indices[vertex] = static_cast<int32_t>(vertex);
+                }
+            }
+            return 0;
+        });
+    };
+
+    auto fillNormalAndPoint = [&](float* data, std::size_t index) {
+        const SbVec3f& n = normals[nindices[index]];
+        data[0] = n[0];
+        data[1] = n[1];
+        data[2] = n[2];
+
+        const SbVec3f& p = points[cindices[index]];
+        data[3] = p[0];
+        data[4] = p[1];
+        data[5] = p[2];
+    };
+
     SoNormalBindingElement::Binding normbind = SoNormalBindingElement::get(state);
     if (normbind == SoNormalBindingElement::PER_VERTEX_INDEXED) {
         if (matbind == SoMaterialBindingElement::PER_FACE) {
-            face_vertices.reserve(3 * numTria
-                                  * 10);  // duplicate each vertex (rgba, normal, vertex)
+            face_vertices.resize(3 * numTria * 10);  // duplicate each vertex (rgba, normal, vertex)
             face_indices.resize(3 * numTria);
 
             if (numcolors != static_cast<int>(numTria)) {
@@ -782,37 +1355,18 @@ void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
             }
 
             // the nindices must have the length of numindices
-            int32_t vertex = 0;
-            int index = 0;
             float t = transp ? transp[0] : 0;
-            for (std::size_t i = 0; i < numTria; i++) {
-                const SbColor& c = pcolors[i];
-                for (int j = 0; j < 3; j++) {
-                    face_vertices.push_back(c[0]);
-                    face_vertices.push_back(c[1]);
-                    face_vertices.push_back(c[2]);
-                    face_vertices.push_back(t);
-
-                    const SbVec3f& n = normals[nindices[index]];
-                    face_vertices.push_back(n[0]);
-                    face_vertices.push_back(n[1]);
-                    face_vertices.push_back(n[2]);
-
-                    const SbVec3f& p = points[cindices[index]];
-                    face_vertices.push_back(p[0]);
-                    face_vertices.push_back(p[1]);
-                    face_vertices.push_back(p[2]);
-
-                    face_indices[vertex] = vertex;
-                    vertex++;
-                    index++;
-                }
-                index++;
-            }
+            fillTriangles(10, [&](float* data, std::size_t face, std::size_t index) {
+                const SbColor& c = pcolors[face];
+                data[0] = c[0];
+                data[1] = c[1];
+                data[2] = c[2];
+                data[3] = t;
+                fillNormalAndPoint(data + 4, index);
+            });
         }
         else if (matbind == SoMaterialBindingElement::PER_VERTEX_INDEXED) {
-            face_vertices.reserve(3 * numTria
-                                  * 10);  // duplicate each vertex (rgba, normal, vertex)
+            face_vertices.resize(3 * numTria * 10);  // duplicate each vertex (rgba, normal, vertex)
             face_indices.resize(3 * numTria);
 
             if (numcolors != coords->getNum()) {
@@ -824,62 +1378,27 @@ void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
             }
 
             // the nindices must have the length of numindices
-            int32_t vertex = 0;
-            int index = 0;
             float t = transp ? transp[0] : 0;
-            for (std::size_t i = 0; i < numTria; i++) {
-                for (int j = 0; j < 3; j++) {
-                    const SbColor& c = pcolors[mindices[index]];
-                    face_vertices.push_back(c[0]);
-                    face_vertices.push_back(c[1]);
-                    face_vertices.push_back(c[2]);
-                    face_vertices.push_back(t);
-
-                    const SbVec3f& n = normals[nindices[index]];
-                    face_vertices.push_back(n[0]);
-                    face_vertices.push_back(n[1]);
-                    face_vertices.push_back(n[2]);
-
-                    const SbVec3f& p = points[cindices[index]];
-                    face_vertices.push_back(p[0]);
-                    face_vertices.push_back(p[1]);
-                    face_vertices.push_back(p[2]);
-
-                    face_indices[vertex] = vertex;
-                    vertex++;
-                    index++;
-                }
-                index++;
-            }
+            fillTriangles(10, [&](float* data, std::size_t /*face*/, std::size_t index) {
+                const SbColor& c = pcolors[mindices[index]];
+                data[0] = c[0];
+                data[1] = c[1];
+                data[2] = c[2];
+                data[3] = t;
+                fillNormalAndPoint(data + 4, index);
+            });
         }
         else {
             // only an overall material
             matbind = SoMaterialBindingElement::OVERALL;
 
-            face_vertices.reserve(3 * numTria * 6);  // duplicate each vertex (normal, vertex)
+            face_vertices.resize(3 * numTria * 6);  // duplicate each vertex (normal, vertex)
             face_indices.resize(3 * numTria);
 
             // the nindices must have the length of numindices
-            int32_t vertex = 0;
-            int index = 0;
-            for (std::size_t i = 0; i < numTria; i++) {
-                for (int j = 0; j < 3; j++) {
-                    const SbVec3f& n = normals[nindices[index]];
-                    face_vertices.push_back(n[0]);
-                    face_vertices.push_back(n[1]);
-                    face_vertices.push_back(n[2]);
-
-                    const SbVec3f& p = points[cindices[index]];
-                    face_vertices.push_back(p[0]);
-                    face_vertices.push_back(p[1]);
-                    face_vertices.push_back(p[2]);
-
-                    face_indices[vertex] = vertex;
-                    vertex++;
-                    index++;
-                }
-                index++;
-            }
+            fillTriangles(6, [&](float* data, std::size_t /*face*/, std::size_t index) {
+                fillNormalAndPoint(data, index);
+            });
         }
     }
     else if (normbind == SoNormalBindingElement::PER_VERTEX) {
@@ -887,31 +1406,35 @@ void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
         matbind = SoMaterialBindingElement::OVERALL;
 
         std::size_t numPts = coords->getNum();
-        face_vertices.reserve(6 * numPts);
-        for (std::size_t i = 0; i < numPts; i++) {
-            const SbVec3f& n = normals[i];
-            face_vertices.push_back(n[0]);
-            face_vertices.push_back(n[1]);
-            face_vertices.push_back(n[2]);
-
-            const SbVec3f& p = coords->get3(i);
-            face_vertices.push_back(p[0]);
-            face_vertices.push_back(p[1]);
-            face_vertices.push_back(p[2]);
-        }
-
-        face_indices.reserve(3 * numTria);
+        face_vertices.resize(6 * numPts);
+        MeshCore::parallel_blocks(numPts, 10000, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                float* data = &face_vertices[6 * i];
+                const SbVec3f& n = normals[i];
+                data[0] = n[0];
+                data[1] = n[1];
+                data[2] = n[2];
+
+                const SbVec3f& p = points[i];
+                data[3] = p[0];
+                data[4] = p[1];
+                data[5] = p[2];
+            }
+            return 0;
+        });
 
-        int index = 0;
+        face_indices.resize(3 * numTria);
         for (std::size_t i = 0; i < numTria; i++) {
-            for (int j = 0; j < 3; j++) {
-                face_indices.push_back(cindices[index]);
-                index++;
+            for (std::size_t j = 0; j < 3; j++) {
+                face_indices[3 * i + j] = cindices[4 * i + j];
             }
-            index++;
         }
     }
 
+    // the proxy of a huge mesh is created from the arrays before they are released
+    if (numTria > this->renderTriangleLimit) {
+        render.prepareProxy(this->renderTriangleLimit);
+    }
     render.generateGLArrays(action, matbind, face_vertices, face_indices);
 
     // getVertexData() internally calls readLockNormalCache() that read locks
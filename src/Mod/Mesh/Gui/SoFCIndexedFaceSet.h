@@ -53,8 +53,15 @@ public:
                           SoMaterialBindingElement::Binding binding,
                           std::vector<float>& vertex,
                           std::vector<int32_t>& index);
+    bool updateColors(SoGLRenderAction*,
+                      SoMaterialBindingElement::Binding binding,
+                      const SbColor* colors,
+                      const int32_t* colorIndex,
+                      float transparency);
     void renderFacesGLArray(SoGLRenderAction* action);
     void renderCoordsGLArray(SoGLRenderAction* action);
+    bool renderProxyGLArray(SoGLRenderAction* action, unsigned int triangleLimit);
+    void prepareProxy(unsigned int triangleLimit);
     bool canRenderGLArray(SoGLRenderAction* action) const;
     bool matchMaterial(SoState*) const;
     void update();
@@ -139,6 +146,7 @@ private:
     void renderVisibleFaces(const SbVec3f*);
 
     void generateGLArrays(SoGLRenderAction* action);
+    bool updateGLArrayColors(SoGLRenderAction* action);
 
 private:
     MeshRenderer render;
@@ -56,6 +56,7 @@
 #include <Gui/Selection/SoFCSelectionAction.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
 #include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/Functional.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 
@@ -895,25 +896,30 @@ void SoFCMeshObjectShape::generateGLArrays(SoState* state)
     const MeshCore::MeshFacetArray& cF = kernel.GetFacets();
 
     // Flat shading
-    face_vertices.reserve(3 * cF.size() * 6);  // duplicate each vertex
+    face_vertices.resize(3 * cF.size() * 6);  // duplicate each vertex
     face_indices.resize(3 * cF.size());
 
-    int indexed = 0;
-    for (const auto& it : cF) {
-        Base::Vector3f n = kernel.GetFacet(it).GetNormal();
-        for (Mesh::PointIndex ptIndex : it._aulPoints) {
-            face_vertices.push_back(n.x);
-            face_vertices.push_back(n.y);
-            face_vertices.push_back(n.z);
-            const Base::Vector3f& v = cP[ptIndex];
-            face_vertices.push_back(v.x);
-            face_vertices.push_back(v.y);
-            face_vertices.push_back(v.z);
-
-            face_indices[indexed] = indexed;
-            indexed++;
+    // the arrays of huge meshes are filled in parallel
+    MeshCore::parallel_blocks(cF.size(), 10000, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshCore::MeshFacet& facet = cF[i];
+            Base::Vector3f n = kernel.GetFacet(facet).GetNormal();
+            for (std::size_t j = 0; j < 3; j++) {
+                std::size_t indexed = 3 * i + j;
+                float* data = &face_vertices[6 * indexed];
+                data[0] = n.x;
+                data[1] = n.y;
+                data[2] = n.z;
+                const Base::Vector3f& v = cP[facet._aulPoints[j]];
+                data[3] = v.x;
+                data[4] = v.y;
+                data[5] = v.z;
+
+                face_indices[indexed] = static_cast<int32_t>(indexed);
+            }
         }
-    }
+        return 0;
+    });
     this->index_array.swap(face_indices);
     this->vertex_array.swap(face_vertices);
 }
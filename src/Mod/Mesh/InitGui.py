@@ -56,3 +56,5 @@ class MeshWorkbench(Workbench):
 
 
 Gui.addWorkbench(MeshWorkbench())
+
+FreeCAD.__unit_test__ += ["MeshTestsGui"]
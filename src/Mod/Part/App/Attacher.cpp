@@ -58,6 +58,9 @@
 # include <TopoDS_Shape.hxx>
 # include <TopoDS_Vertex.hxx>
 # include <TopTools_HSequenceOfShape.hxx>
+# include <list>
+# include <map>
+# include <unordered_map>
 #endif
 
 #include <App/Application.h>
@@ -74,6 +77,7 @@
 
 using namespace Part;
 using namespace Attacher;
+namespace sp = std::placeholders;
 
 //These strings are for mode list enum property.
 const char* AttachEngine::eMapModeStrings[]= {
@@ -816,6 +820,203 @@ GProp_GProps AttachEngine::getInertialPropsOfShape(const std::vector<const TopoS
     }
 }
 
+namespace {
+
+/*!
+ * \brief The ReferenceCache class keeps the sub-shapes resolved by
+ * AttachEngine::readLinks(), together with their classified reference type.
+ *
+ * Entries are keyed by the referenced object and the subname. Every object
+ * along the subname path gets a revision counter that is bumped whenever any
+ * of its properties changes, so an entry stays valid only as long as none of
+ * the objects it was resolved through has been modified. Outdated entries are
+ * dropped when they are looked up, entries of deleted objects and documents
+ * when these are deleted, and the least recently used entries once the cache
+ * holds more than maxEntries of them. Revision counters are only kept for
+ * objects that are used by an entry.
+ */
+class ReferenceCache
+{
+public:
+    static ReferenceCache& instance()
+    {
+        static ReferenceCache inst;
+        return inst;
+    }
+
+    bool get(const App::DocumentObject* obj,
+             const std::string& sub,
+             TopoShape& shape,
+             eRefType& type)
+    {
+        auto it = entries.find(Key(obj, sub));
+        if (it == entries.end()) {
+            return false;
+        }
+        const Entry& entry = it->second;
+        for (const auto& dep : entry.deps) {
+            if (getRevision(dep.first) != dep.second) {
+                erase(it);
+                return false;
+            }
+        }
+        lru.splice(lru.begin(), lru, entry.pos);
+        shape = entry.shape;
+        type = entry.type;
+        return true;
+    }
+
+    void set(const App::DocumentObject* obj,
+             const std::string& sub,
+             const TopoShape& shape,
+             eRefType type)
+    {
+        Key key(obj, sub);
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            erase(it);
+        }
+
+        Entry& entry = entries[key];
+        entry.shape = shape;
+        entry.type = type;
+        lru.push_front(key);
+        entry.pos = lru.begin();
+        auto addDep = [&entry, this](const App::DocumentObject* dep) {
+            for (const auto& d : entry.deps) {
+                if (d.first == dep) {
+                    return;
+                }
+            }
+            Revision& rev = revisions[dep];
+            ++rev.users;
+            entry.deps.emplace_back(dep, rev.value);
+        };
+        addDep(obj);
+        for (auto dep : obj->getSubObjectList(sub.c_str())) {
+            if (!dep) {
+                continue;
+            }
+            addDep(dep);
+            // links take their shape from the linked object
+            if (auto linked = dep->getLinkedObject(true)) {
+                addDep(linked);
+            }
+        }
+
+        if (entries.size() > maxEntries) {
+            erase(entries.find(lru.back()));
+        }
+    }
+
+    void clear()
+    {
+        entries.clear();
+        revisions.clear();
+        lru.clear();
+    }
+
+private:
+    using Key = std::pair<const App::DocumentObject*, std::string>;
+    struct Entry
+    {
+        TopoShape shape;
+        eRefType type = rtAnything;
+        std::vector<std::pair<const App::DocumentObject*, unsigned long>> deps;
+        std::list<Key>::iterator pos;
+    };
+    struct Revision
+    {
+        unsigned long value = 0;
+        std::size_t users = 0;
+    };
+
+    static constexpr std::size_t maxEntries = 1000;
+
+    ReferenceCache()
+    {
+        // NOLINTBEGIN
+        connChangedObject = App::GetApplication().signalChangedObject.connect(
+            std::bind(&ReferenceCache::slotChangedObject, this, sp::_1, sp::_2));
+        connDeletedObject = App::GetApplication().signalDeletedObject.connect(
+            std::bind(&ReferenceCache::slotDeletedObject, this, sp::_1));
+        connDeleteDocument = App::GetApplication().signalDeleteDocument.connect(
+            std::bind(&ReferenceCache::slotDeleteDocument, this, sp::_1));
+        // NOLINTEND
+    }
+
+    unsigned long getRevision(const App::DocumentObject* obj) const
+    {
+        auto it = revisions.find(obj);
+        return it == revisions.end() ? 0 : it->second.value;
+    }
+
+    void erase(std::map<Key, Entry>::iterator it)
+    {
+        for (const auto& dep : it->second.deps) {
+            auto rev = revisions.find(dep.first);
+            if (rev != revisions.end() && --rev->second.users == 0) {
+                revisions.erase(rev);
+            }
+        }
+        lru.erase(it->second.pos);
+        entries.erase(it);
+    }
+
+    void slotChangedObject(const App::DocumentObject& obj, const App::Property&)
+    {
+        auto it = revisions.find(&obj);
+        if (it != revisions.end()) {
+            ++it->second.value;
+        }
+    }
+
+    void slotDeletedObject(const App::DocumentObject& obj)
+    {
+        forget([&obj](const App::DocumentObject* o) { return o == &obj; });
+    }
+
+    void slotDeleteDocument(const App::Document& doc)
+    {
+        forget([&doc](const App::DocumentObject* o) { return o->getDocument() == &doc; });
+    }
+
+    template<class Pred>
+    void forget(Pred pred)
+    {
+        for (auto it = entries.begin(); it != entries.end();) {
+            bool stale = false;
+            for (const auto& dep : it->second.deps) {
+                if (pred(dep.first)) {
+                    stale = true;
+                    break;
+                }
+            }
+            auto next = std::next(it);
+            if (stale) {
+                erase(it);
+            }
+            it = next;
+        }
+    }
+
+private:
+    std::map<Key, Entry> entries;
+    std::unordered_map<const App::DocumentObject*, Revision> revisions;
+    // keys of the entries, most recently used first
+    std::list<Key> lru;
+    boost::signals2::scoped_connection connChangedObject;
+    boost::signals2::scoped_connection connDeletedObject;
+    boost::signals2::scoped_connection connDeleteDocument;
+};
+
+}  // namespace
+
+void AttachEngine::clearReferenceCache()
+{
+    ReferenceCache::instance().clear();
+}
+
 /*!
  * \brief AttachEngine3D::readLinks
  * \param shapes
@@ -832,6 +1033,8 @@ void AttachEngine::readLinks(const std::vector<App::DocumentObject*>& objs,
     shapes.resize(objs.size());
     types.resize(objs.size());
 
+    auto& cache = ReferenceCache::instance();
+
     for (std::size_t i = 0; i < objs.size(); i++) {
         auto geof = extractGeoFeature(objs[i]);
         if (!geof) {
@@ -840,6 +1043,13 @@ void AttachEngine::readLinks(const std::vector<App::DocumentObject*>& objs,
                           << objs[i]->getNameInDocument() << "'");
         }
 
+        TopoShape cached;
+        if (cache.get(objs[i], subs[i], cached, types[i])) {
+            storage.emplace_back(cached);
+            shapes[i] = &(storage.back());
+            continue;
+        }
+
         auto shape = extractSubShape(objs[i], subs[i]);
         if (shape.isNull()) {
             FC_THROWM(AttachEngineException,
@@ -857,6 +1067,8 @@ void AttachEngine::readLinks(const std::vector<App::DocumentObject*>& objs,
         if (subs[i].length() == 0) {
             types[i] = eRefType(types[i] | rtFlagHasPlacement);
         }
+
+        cache.set(objs[i], subs[i], shape, types[i]);
     }
 }
 
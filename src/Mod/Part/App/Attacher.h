@@ -376,6 +376,13 @@ public://helper functions that may be useful outside of the class
      */
     static void verifyReferencesAreSafe(const App::PropertyLinkSubList& references);
 
+    /**
+     * @brief clearReferenceCache: drops all sub-shapes cached by readLinks().
+     * Cached references are invalidated automatically when any object along
+     * the reference path changes, so this is only needed to release memory.
+     */
+    static void clearReferenceCache();
+
 public: //enums
     static const char* eMapModeStrings[];
     static const char* eRefTypeStrings[];
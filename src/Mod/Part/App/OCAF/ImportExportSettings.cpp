@@ -272,6 +272,16 @@ bool ImportExportSettings::getShowProgress() const
     return pGroup->GetBool("ShowProgress", true);
 }
 
+void ImportExportSettings::setTessellateOnImport(bool on)
+{
+    pGroup->SetBool("TessellateOnImport", on);
+}
+
+bool ImportExportSettings::getTessellateOnImport() const
+{
+    return pGroup->GetBool("TessellateOnImport", false);
+}
+
 void ImportExportSettings::setImportMode(ImportExportSettings::ImportMode mode)
 {
     pGroup->SetInt("ImportMode", static_cast<long>(mode));
@@ -95,6 +95,9 @@ public:
     void setShowProgress(bool);
     bool getShowProgress() const;
 
+    void setTessellateOnImport(bool);
+    bool getTessellateOnImport() const;
+
     void setImportMode(ImportMode);
     ImportMode getImportMode() const;
 
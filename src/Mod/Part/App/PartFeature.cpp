@@ -72,6 +72,7 @@
 #include <Base/Tools.h>
 #include <Mod/Material/App/MaterialManager.h>
 
+#include "Attacher.h"
 #include "Geometry.h"
 #include "PartFeature.h"
 #include "PartFeaturePy.h"
@@ -885,6 +886,7 @@ void Feature::setMaterialAppearance(const App::Material& material)
 // Toponaming project March 2024:  This method should be going away when we get to the python layer.
 void Feature::clearShapeCache() {
 //    _ShapeCache.cache.clear();
+    Attacher::AttachEngine::clearReferenceCache();
 }
 
 static TopoShape _getTopoShape(const App::DocumentObject* obj,
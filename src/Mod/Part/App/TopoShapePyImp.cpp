@@ -71,6 +71,7 @@
 #include <Base/FileInfo.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/MatrixPy.h>
+#include <Base/PyBuffer.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Rotation.h>
 #include <Base/Stream.h>
@@ -1567,6 +1568,47 @@ PyObject* TopoShapePy::tessellate(PyObject *args)
     }
 }
 
+PyObject* TopoShapePy::tessellateToBuffers(PyObject *args)
+{
+    double tolerance;
+    PyObject* ok = Py_False;
+    if (!PyArg_ParseTuple(args, "d|O!", &tolerance, &PyBool_Type, &ok))
+        return nullptr;
+
+    try {
+        std::vector<Base::Vector3d> Points;
+        std::vector<Data::ComplexGeoData::Facet> Facets;
+        if (Base::asBoolean(ok))
+            BRepTools::Clean(getTopoShapePtr()->getShape());
+        getTopoShapePtr()->getFaces(Points, Facets,tolerance);
+
+        double* coords {};
+        Py::Object vertex = Base::createMemoryView(static_cast<Py_ssize_t>(Points.size()), 3, coords);
+        for (const auto & Point : Points) {
+            *coords++ = Point.x;
+            *coords++ = Point.y;
+            *coords++ = Point.z;
+        }
+
+        std::uint32_t* indices {};
+        Py::Object facet = Base::createMemoryView(static_cast<Py_ssize_t>(Facets.size()), 3, indices);
+        for (const auto& it : Facets) {
+            *indices++ = it.I1;
+            *indices++ = it.I2;
+            *indices++ = it.I3;
+        }
+
+        return Py::new_reference_to(Py::TupleN(vertex, facet));
+    }
+    catch (Standard_Failure& e) {
+        PyErr_SetString(PartExceptionOCCError, e.GetMessageString());
+        return nullptr;
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+}
+
 PyObject* TopoShapePy::project(PyObject *args)
 {
     PyObject *obj;
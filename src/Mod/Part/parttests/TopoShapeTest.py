@@ -805,3 +805,30 @@ class TopoShapeTest(unittest.TestCase, TopoShapeAssertions):
         if cut1.ElementMapVersion != "":  # Should be '4' as of Mar 2023.
             self.assertKeysInMap(cut1.ElementReverseMap, refkeys )
         self.assertEqual(len(cut1.ElementReverseMap.keys()),len(refkeys))
+
+    def testTopoShapeTessellateToBuffers(self):
+        # Arrange
+        points, facets = self.box.tessellate(0.1)
+        # Act
+        vertex, triangles = self.box.tessellateToBuffers(0.1)
+        # Assert
+        self.assertEqual(vertex.format, "d")
+        self.assertEqual(vertex.shape, (len(points), 3))
+        self.assertEqual(triangles.format, "I")
+        self.assertEqual(triangles.shape, (len(facets), 3))
+        for row, point in zip(vertex.tolist(), points):
+            self.assertEqual(row, [point.x, point.y, point.z])
+        self.assertEqual(triangles.tolist(), [list(facet) for facet in facets])
+        # the buffers survive a round trip through bytes
+        copied = memoryview(vertex.tobytes()).cast("d", vertex.shape)
+        self.assertEqual(copied.tolist(), vertex.tolist())
+
+    def testTopoShapeTessellateToBuffersEmpty(self):
+        # Arrange
+        line = Part.makeLine(App.Vector(0, 0, 0), App.Vector(1, 0, 0))
+        # Act
+        vertex, triangles = line.tessellateToBuffers(0.1)
+        # Assert
+        self.assertEqual(vertex.shape, (0, 3))
+        self.assertEqual(triangles.shape, (0, 3))
+        self.assertEqual(vertex.tolist(), [])
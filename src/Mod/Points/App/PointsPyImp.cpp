@@ -28,6 +28,7 @@
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/PyBuffer.h>
 #include <Base/VectorPy.h>
 
 #include "Points.h"
@@ -189,6 +190,60 @@ PyObject* PointsPy::addPoints(PyObject* args)
     Py_Return;
 }
 
+PyObject* PointsPy::getPointBuffer(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    try {
+        const std::vector<Base::Vector3f>& points = getPointKernelPtr()->getBasicPoints();
+        Base::Matrix4D mat = getPointKernelPtr()->getTransform();
+        float* data {};
+        Py::Object view =
+            Base::createMemoryView(static_cast<Py_ssize_t>(points.size()), 3, data);
+        for (const auto& pnt : points) {
+            Base::Vector3d vec = mat * Base::convertTo<Base::Vector3d>(pnt);
+            *data++ = static_cast<float>(vec.x);
+            *data++ = static_cast<float>(vec.y);
+            *data++ = static_cast<float>(vec.z);
+        }
+        return Py::new_reference_to(view);
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+}
+
+PyObject* PointsPy::setPointBuffer(PyObject* args)
+{
+    PyObject* obj {};
+    if (!PyArg_ParseTuple(args, "O", &obj)) {
+        return nullptr;
+    }
+
+    try {
+        std::vector<double> values = Base::readFloatBuffer(obj, 3);
+
+        // the coordinates are global like the ones of getPointBuffer()
+        Base::Matrix4D mat = getPointKernelPtr()->getTransform();
+        mat.inverseGauss();
+
+        std::vector<Base::Vector3f> points;
+        points.reserve(values.size() / 3);
+        for (std::size_t i = 0; i < values.size(); i += 3) {
+            Base::Vector3d vec = mat * Base::Vector3d(values[i], values[i + 1], values[i + 2]);
+            points.push_back(Base::convertTo<Base::Vector3f>(vec));
+        }
+        getPointKernelPtr()->swap(points);
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+
+    Py_Return;
+}
+
 PyObject* PointsPy::fromSegment(PyObject* args)
 {
     PyObject* obj {};
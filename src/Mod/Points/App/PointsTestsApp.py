@@ -0,0 +1,63 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+import array
+import unittest
+
+import FreeCAD
+import Points
+from FreeCAD import Base
+
+# ---------------------------------------------------------------------------
+# define the functions to test the FreeCAD points module
+# ---------------------------------------------------------------------------
+
+
+class PointsBufferTestCases(unittest.TestCase):
+    def setUp(self):
+        self.points = Points.Points()
+        self.points.addPoints([(x, 2.0 * x, 3.0 * x) for x in range(10)])
+
+    def testGetPointBuffer(self):
+        buffer = self.points.getPointBuffer()
+        self.assertEqual(buffer.format, "f")
+        self.assertEqual(buffer.shape, (10, 3))
+        for row, pnt in zip(buffer.tolist(), self.points.Points):
+            self.assertEqual(row, [pnt.x, pnt.y, pnt.z])
+
+    def testSetPointBuffer(self):
+        points = Points.Points()
+        points.setPointBuffer(self.points.getPointBuffer())
+        self.assertEqual(points.CountPoints, 10)
+        for pnt, other in zip(points.Points, self.points.Points):
+            self.assertEqual(pnt, other)
+
+        # any buffer of numbers in native format is accepted
+        points.setPointBuffer(array.array("d", [1, 2, 3, 4, 5, 6]))
+        self.assertEqual(points.CountPoints, 2)
+        self.assertEqual(points.Points[1], Base.Vector(4, 5, 6))
+        with self.assertRaises(ValueError):
+            points.setPointBuffer(array.array("d", [1, 2, 3, 4]))
+
+    def testBuffersWithPlacement(self):
+        points = self.points.copy()
+        points.Placement = FreeCAD.Placement(
+            Base.Vector(10, 20, 30), FreeCAD.Rotation(Base.Vector(0, 0, 1), 90)
+        )
+        buffer = points.getPointBuffer()
+        for row, pnt in zip(buffer.tolist(), points.Points):
+            self.assertTrue(Base.Vector(*row).isEqual(pnt, 1e-5))
+
+        # the buffer coordinates are global, the placement is kept
+        placement = points.Placement
+        points.setPointBuffer(buffer)
+        self.assertEqual(points.Placement, placement)
+        for pnt, other in zip(points.Points, self.points.Points):
+            self.assertTrue(pnt.isEqual(placement.multVec(other), 1e-5))
+
+    def testEmptyBuffer(self):
+        buffer = Points.Points().getPointBuffer()
+        self.assertEqual(buffer.shape, (0, 3))
+        self.assertEqual(buffer.tolist(), [])
+
+        self.points.setPointBuffer(buffer)
+        self.assertEqual(self.points.CountPoints, 0)
@@ -22,7 +22,6 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
-#include <QtConcurrentMap>
 #include <algorithm>
 #include <cmath>
 #include <iostream>
@@ -38,10 +37,6 @@
 #include "Points.h"
 #include "Properties.h"
 
-#ifdef _MSC_VER
-#include <ppl.h>
-#endif
-
 
 using namespace Points;
 using namespace std;
@@ -383,17 +378,7 @@ void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
     aboutToSetValue();
 
     // Rotate the normal vectors
-#ifdef _MSC_VER
-    Concurrency::parallel_for_each(_lValueList.begin(),
-                                   _lValueList.end(),
-                                   [rot](Base::Vector3f& value) {
-                                       value = rot * value;
-                                   });
-#else
-    QtConcurrent::blockingMap(_lValueList, [rot](Base::Vector3f& value) {
-        rot.multVec(value, value);
-    });
-#endif
+    rot.multVec(_lValueList.data(), _lValueList.data(), _lValueList.size());
 
     hasSetValue();
 }
@@ -26,3 +26,5 @@
 # Append the open handler
 FreeCAD.addImportType("Point formats (*.asc *.ASC *.pcd *.PCD *.ply *.PLY *.e57 *.E57)", "Points")
 FreeCAD.addExportType("Point formats (*.asc *.pcd *.ply)", "Points")
+
+FreeCAD.__unit_test__ += ["PointsTestsApp"]
@@ -71,6 +71,8 @@ void PropertySheet::clear()
 
     propertyNameToCellMap.clear();
     cellToPropertyNameMap.clear();
+    cellToCellMap.clear();
+    cellDependants.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
     aliasProp.clear();
@@ -287,6 +289,8 @@ PropertySheet::PropertySheet(const PropertySheet& other)
     , owner(other.owner)
     , propertyNameToCellMap(other.propertyNameToCellMap)
     , cellToPropertyNameMap(other.cellToPropertyNameMap)
+    , cellToCellMap(other.cellToCellMap)
+    , cellDependants(other.cellDependants)
     , documentObjectToCellMap(other.documentObjectToCellMap)
     , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
     , aliasProp(other.aliasProp)
@@ -1386,6 +1390,14 @@ void PropertySheet::addDependencies(CellAddress key)
                 propertyNameToCellMap[propName].insert(key);
                 cellToPropertyNameMap[key].insert(propName);
 
+                // A cell of this sheet?
+                if (docObj == owner) {
+                    CellAddress addr = stringToAddress(name.c_str(), true);
+                    if (addr.isValid()) {
+                        addCellDependency(key, addr);
+                    }
+                }
+
                 // Also an alias?
                 if (!name.empty() && docObj->isDerivedFrom<Sheet>()) {
                     auto other = static_cast<Sheet*>(docObj);
@@ -1398,6 +1410,10 @@ void PropertySheet::addDependencies(CellAddress key)
                         // Insert into maps
                         propertyNameToCellMap[propName].insert(key);
                         cellToPropertyNameMap[key].insert(propName);
+
+                        if (docObj == owner) {
+                            addCellDependency(key, j->second);
+                        }
                     }
                 }
             }
@@ -1405,6 +1421,16 @@ void PropertySheet::addDependencies(CellAddress key)
     }
 }
 
+/**
+ * Record that the cell at \a key reads the cell at \a dep of the same sheet.
+ */
+
+void PropertySheet::addCellDependency(CellAddress key, CellAddress dep)
+{
+    cellToCellMap[key].insert(dep);
+    cellDependants[dep].insert(key);
+}
+
 /**
  * Remove dependencies given by \a expression for cell at \a key.
  *
@@ -1436,6 +1462,26 @@ void PropertySheet::removeDependencies(CellAddress key)
         cellToPropertyNameMap.erase(i1);
     }
 
+    /* Remove from the cell graph of this sheet */
+
+    auto i3 = cellToCellMap.find(key);
+
+    if (i3 != cellToCellMap.end()) {
+        for (const auto& addr : i3->second) {
+            auto k = cellDependants.find(addr);
+
+            if (k != cellDependants.end()) {
+                k->second.erase(key);
+
+                if (k->second.empty()) {
+                    cellDependants.erase(k);
+                }
+            }
+        }
+
+        cellToCellMap.erase(i3);
+    }
+
     /* Remove from DocumentObject <-> Key maps */
 
     std::map<CellAddress, std::set<std::string>>::iterator i2 = cellToDocumentObjectMap.find(key);
@@ -1631,6 +1677,19 @@ const std::set<CellAddress>& PropertySheet::getDeps(const std::string& name) con
     }
 }
 
+const std::set<CellAddress>& PropertySheet::getCellDependants(CellAddress pos) const
+{
+    static std::set<CellAddress> empty;
+    auto i = cellDependants.find(pos);
+
+    if (i != cellDependants.end()) {
+        return i->second;
+    }
+    else {
+        return empty;
+    }
+}
+
 const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
 {
     static std::set<std::string> empty;
@@ -200,6 +200,9 @@ public:
 
     const std::set<std::string>& getDeps(App::CellAddress pos) const;
 
+    /// Cells of this sheet that read the cell at \a pos
+    const std::set<App::CellAddress>& getCellDependants(App::CellAddress pos) const;
+
     void recomputeDependencies(App::CellAddress key);
 
     PyObject* getPyObject() override;
@@ -303,6 +306,8 @@ private:
 
     void removeDependencies(App::CellAddress key);
 
+    void addCellDependency(App::CellAddress key, App::CellAddress dep);
+
     void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
     void recomputeDependants(const App::DocumentObject* obj, const char* propName);
 
@@ -314,6 +319,15 @@ private:
     /*! Properties this cell depends on */
     std::map<App::CellAddress, std::set<std::string>> cellToPropertyNameMap;
 
+    /*! Cells of this sheet a cell depends on */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToCellMap;
+
+    /*! Cell dependency graph of this sheet, i.e. when the cell given in key
+      changes, the set of addresses needs to be recomputed. Kept up to date
+      by addDependencies() and removeDependencies().
+      */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellDependants;
+
     /*! Cell dependencies, i.e when a change occurs to documentObject given in key,
       the set of addresses needs to be recomputed.
       */
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <boost/tokenizer.hpp>
 #include <deque>
 #include <memory>
@@ -33,6 +34,7 @@
 #include <string>
 #include <set>
 #include <vector>
+#include <QtConcurrentMap>
 #endif
 
 #include <App/Application.h>
@@ -71,6 +73,9 @@ using Traits = boost::graph_traits<DependencyList>;
 using Vertex = Traits::vertex_descriptor;
 using Edge = Traits::edge_descriptor;
 
+// Minimum number of independent cells to evaluate them in parallel
+static const std::size_t minParallelCells = 64;
+
 /**
  * Construct a new Sheet object.
  */
@@ -349,9 +354,6 @@ bool Sheet::exportToFile(const std::string& filename,
         else if (auto p = freecad_dynamic_cast<PropertyString>(prop)) {
             field << p->getValue();
         }
-        else {
-            assert(0);
-        }
 
         std::string str = field.str();
 
@@ -753,15 +755,64 @@ struct CurrentAddressLock
     int& col;
 };
 
+/**
+ * Set the property for cell \p key from the evaluated expression \a value.
+ *
+ * @param key   The address of the cell we want to create a Property for
+ * @param value A NumberExpression, StringExpression or PyObjectExpression.
+ *
+ */
+
+Property* Sheet::setPropertyValue(CellAddress key, const Expression* value)
+{
+    /* Eval returns either NumberExpression or StringExpression, or
+     * PyObjectExpression objects */
+    auto number = freecad_dynamic_cast<NumberExpression>(value);
+    if (number) {
+        long l;
+        auto constant = freecad_dynamic_cast<ConstantExpression>(value);
+        if (constant && !constant->isNumber()) {
+            Base::PyGILStateLocker lock;
+            return setObjectProperty(key, constant->getPyValue());
+        }
+        else if (!number->getUnit().isEmpty()) {
+            return setQuantityProperty(key, number->getValue(), number->getUnit());
+        }
+        else if (number->isInteger(&l)) {
+            return setIntegerProperty(key, l);
+        }
+        else {
+            return setFloatProperty(key, number->getValue());
+        }
+    }
+    else {
+        auto str_expr = freecad_dynamic_cast<StringExpression>(value);
+        if (str_expr) {
+            return setStringProperty(key, str_expr->getText().c_str());
+        }
+        else {
+            Base::PyGILStateLocker lock;
+            auto py_expr = freecad_dynamic_cast<PyObjectExpression>(value);
+            if (py_expr) {
+                return setObjectProperty(key, py_expr->getPyValue());
+            }
+            else {
+                return setObjectProperty(key, Py::Object());
+            }
+        }
+    }
+}
+
 /**
  * Update the Property given by \a key. This will also eventually trigger recomputations of cells
  * depending on \a key.
  *
  * @param key The address of the cell we want to recompute.
+ * @param value The value of the cell expression if it has been evaluated in advance.
  *
  */
 
-void Sheet::updateProperty(CellAddress key)
+void Sheet::updateProperty(CellAddress key, std::unique_ptr<Expression> value)
 {
     Cell* cell = getCell(key);
 
@@ -769,7 +820,10 @@ void Sheet::updateProperty(CellAddress key)
         std::unique_ptr<Expression> output;
         const Expression* input = cell->getExpression();
 
-        if (input) {
+        if (input && value) {
+            output = std::move(value);
+        }
+        else if (input) {
             CurrentAddressLock lock(currentRow, currentCol, key);
             output.reset(input->eval());
         }
@@ -785,42 +839,7 @@ void Sheet::updateProperty(CellAddress key)
             }
         }
 
-        /* Eval returns either NumberExpression or StringExpression, or
-         * PyObjectExpression objects */
-        auto number = freecad_dynamic_cast<NumberExpression>(output.get());
-        if (number) {
-            long l;
-            auto constant = freecad_dynamic_cast<ConstantExpression>(output.get());
-            if (constant && !constant->isNumber()) {
-                Base::PyGILStateLocker lock;
-                setObjectProperty(key, constant->getPyValue());
-            }
-            else if (!number->getUnit().isEmpty()) {
-                setQuantityProperty(key, number->getValue(), number->getUnit());
-            }
-            else if (number->isInteger(&l)) {
-                setIntegerProperty(key, l);
-            }
-            else {
-                setFloatProperty(key, number->getValue());
-            }
-        }
-        else {
-            auto str_expr = freecad_dynamic_cast<StringExpression>(output.get());
-            if (str_expr) {
-                setStringProperty(key, str_expr->getText().c_str());
-            }
-            else {
-                Base::PyGILStateLocker lock;
-                auto py_expr = freecad_dynamic_cast<PyObjectExpression>(output.get());
-                if (py_expr) {
-                    setObjectProperty(key, py_expr->getPyValue());
-                }
-                else {
-                    setObjectProperty(key, Py::Object());
-                }
-            }
-        }
+        setPropertyValue(key, output.get());
     }
     else {
         clear(key);
@@ -908,9 +927,10 @@ void Sheet::recomputeCells(Range range)
 /**
  * @brief Recompute cell at address \a p.
  * @param p Address of cell.
+ * @param value Value of the cell expression if it has been evaluated in advance.
  */
 
-void Sheet::recomputeCell(CellAddress p)
+void Sheet::recomputeCell(CellAddress p, std::unique_ptr<Expression> value)
 {
     Cell* cell = cells.getValue(p);
 
@@ -921,7 +941,7 @@ void Sheet::recomputeCell(CellAddress p)
             cell->setContent(content.c_str());
         }
 
-        updateProperty(p);
+        updateProperty(p, std::move(value));
 
         if (!cell || !cell->hasException()) {
             cells.clearDirty(p);
@@ -1038,6 +1058,193 @@ void Sheet::updateBindings()
     }
 }
 
+/**
+ * @brief Check whether \a expr is plain arithmetic on numbers and cells of
+ * this sheet, that can be evaluated without Python.
+ * @param expr Expression to check.
+ * @param refs Receives the addresses of the referenced cells.
+ * @return True if the expression can be passed to evaluatePlainArithmetic().
+ */
+
+bool Sheet::isPlainArithmetic(const Expression* expr,
+                              std::map<const Expression*, CellAddress>& refs) const
+{
+    if (auto op = freecad_dynamic_cast<OperatorExpression>(expr)) {
+        switch (op->getOperator()) {
+            case OperatorExpression::ADD:
+            case OperatorExpression::SUB:
+            case OperatorExpression::MUL:
+            case OperatorExpression::DIV:
+            case OperatorExpression::UNIT:
+                return isPlainArithmetic(op->getLeft(), refs)
+                    && isPlainArithmetic(op->getRight(), refs);
+            case OperatorExpression::NEG:
+            case OperatorExpression::POS:
+                return isPlainArithmetic(op->getLeft(), refs);
+            default:
+                return false;
+        }
+    }
+    if (auto var = freecad_dynamic_cast<VariableExpression>(expr)) {
+        // inspect the components directly, resolving the path would look up
+        // the cell property
+        ObjectIdentifier path = var->getPath();
+        const auto& components = path.getComponents();
+        if (path.hasDocumentObjectName() || components.size() != 1
+            || !components.front().isSimple()) {
+            return false;
+        }
+        CellAddress addr = getCellAddress(components.front().getName().c_str(), true);
+        if (!addr.isValid()) {
+            return false;
+        }
+        refs[expr] = addr;
+        return true;
+    }
+    if (auto constant = freecad_dynamic_cast<ConstantExpression>(expr)) {
+        return constant->isNumber();
+    }
+    return expr->is<NumberExpression>() || expr->is<UnitExpression>();
+}
+
+/**
+ * @brief Evaluate an expression accepted by isPlainArithmetic(). This does
+ * not use Python and only reads the values of other cells, so it may be
+ * called from several threads.
+ * @param expr Expression to evaluate.
+ * @param refs Addresses of the referenced cells.
+ * @param result Receives the value.
+ * @return False if the expression must be evaluated the normal way, e.g.
+ * because a referenced cell is not a number or the units do not match.
+ */
+
+bool Sheet::evaluatePlainArithmetic(const Expression* expr,
+                                    const std::map<const Expression*, CellAddress>& refs,
+                                    Base::Quantity& result) const
+{
+    try {
+        if (auto op = freecad_dynamic_cast<OperatorExpression>(expr)) {
+            Base::Quantity left, right;
+            if (!evaluatePlainArithmetic(op->getLeft(), refs, left)) {
+                return false;
+            }
+            switch (op->getOperator()) {
+                case OperatorExpression::NEG:
+                    result = -left;
+                    return true;
+                case OperatorExpression::POS:
+                    result = left;
+                    return true;
+                default:
+                    break;
+            }
+            if (!evaluatePlainArithmetic(op->getRight(), refs, right)) {
+                return false;
+            }
+            switch (op->getOperator()) {
+                case OperatorExpression::ADD:
+                    result = left + right;
+                    return true;
+                case OperatorExpression::SUB:
+                    result = left - right;
+                    return true;
+                case OperatorExpression::MUL:
+                case OperatorExpression::UNIT:
+                    result = left * right;
+                    return true;
+                case OperatorExpression::DIV:
+                    // let Python report the division by zero
+                    if (right.getValue() == 0.0) {
+                        return false;
+                    }
+                    result = left / right;
+                    return true;
+                default:
+                    return false;
+            }
+        }
+        if (freecad_dynamic_cast<VariableExpression>(expr)) {
+            // only read, the properties are not changed while the level is evaluated
+            Property* prop = getProperty(refs.at(expr));
+            if (auto quantity = freecad_dynamic_cast<PropertyQuantity>(prop)) {
+                result = quantity->getQuantityValue();
+                return true;
+            }
+            if (auto number = freecad_dynamic_cast<PropertyFloat>(prop)) {
+                result = Base::Quantity(number->getValue());
+                return true;
+            }
+            if (auto integer = freecad_dynamic_cast<PropertyInteger>(prop)) {
+                result = Base::Quantity(double(integer->getValue()));
+                return true;
+            }
+            return false;
+        }
+        if (auto unit = freecad_dynamic_cast<UnitExpression>(expr)) {
+            result = unit->getQuantity();
+            return true;
+        }
+    }
+    catch (const Base::Exception&) {
+        // e.g. unit mismatch, the normal evaluation reports it
+    }
+    return false;
+}
+
+/**
+ * @brief Recompute the cells of one dependency level. The cells do not depend
+ * on each other, so plain arithmetic is evaluated in parallel first. All cells
+ * are then updated one after the other in the given order, cells that could
+ * not be evaluated in parallel are evaluated the normal way at this point, so
+ * that errors are reported in a deterministic order.
+ * @param level Cells to recompute.
+ */
+
+void Sheet::recomputeLevel(const std::vector<CellAddress>& level)
+{
+    struct Task
+    {
+        CellAddress address;
+        const Expression* expression;
+        std::unique_ptr<Expression> value;
+    };
+
+    std::vector<Task> tasks;
+    std::map<const Expression*, CellAddress> refs;
+    if (level.size() >= minParallelCells) {
+        for (const auto& addr : level) {
+            const Cell* cell = cells.getValue(addr);
+            if (!cell || cell->hasException()) {
+                continue;
+            }
+            const Expression* expr = cell->getExpression();
+            if (expr && isPlainArithmetic(expr, refs)) {
+                tasks.push_back({addr, expr, nullptr});
+            }
+        }
+    }
+
+    if (tasks.size() >= minParallelCells) {
+        QtConcurrent::blockingMap(tasks, [this, &refs](Task& task) {
+            Base::Quantity value;
+            if (evaluatePlainArithmetic(task.expression, refs, value)) {
+                task.value = std::make_unique<NumberExpression>(this, value);
+            }
+        });
+    }
+
+    auto task = tasks.begin();
+    for (const auto& addr : level) {
+        std::unique_ptr<Expression> value;
+        if (task != tasks.end() && task->address == addr) {
+            value = std::move(task->value);
+            ++task;
+        }
+        FC_TRACE(addr.toString());
+        recomputeCell(addr, std::move(value));
+    }
+}
+
 /**
  * Update the document properties.
  *
@@ -1056,50 +1263,79 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
-    DependencyList graph;
-    std::map<CellAddress, Vertex> VertexList;
-    std::map<Vertex, CellAddress> VertexIndexList;
+    // Collect the dirty cells and all cells depending on them. The cell
+    // dependency graph is kept up to date by PropertySheet on every edit, so
+    // only the affected part of the sheet is visited here.
+    std::map<CellAddress, int> inDegree;
     std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
+    for (const auto& addr : dirtyCells) {
+        inDegree.emplace(addr, 0);
+    }
     while (!workQueue.empty()) {
         CellAddress currPos = workQueue.front();
         workQueue.pop_front();
 
-        // Insert into map of CellPos -> Index, if it doesn't exist already
-        auto res = VertexList.emplace(currPos, Vertex());
-        if (res.second) {
-            res.first->second = add_vertex(graph);
-            VertexIndexList[res.first->second] = currPos;
-        }
-
-        // Process cells that depend on the current cell
-        for (auto& dep : providesTo(currPos)) {
-            auto resDep = VertexList.emplace(dep, Vertex());
-            if (resDep.second) {
-                resDep.first->second = add_vertex(graph);
-                VertexIndexList[resDep.first->second] = dep;
-                if (dirtyCells.insert(dep).second) {
-                    workQueue.push_back(dep);
-                }
+        for (const auto& dep : providesTo(currPos)) {
+            if (inDegree.emplace(dep, 0).second) {
+                dirtyCells.insert(dep);
+                workQueue.push_back(dep);
             }
-            // Add edge to graph to signal dependency
-            add_edge(res.first->second, resDep.first->second, graph);
         }
     }
-    // Compute cells
-    std::list<Vertex> make_order;
-    // Sort graph topologically to find evaluation order
-    try {
-        boost::topological_sort(graph, std::front_inserter(make_order));
-        // Recompute cells
+
+    // Count for every cell how many of its inputs are recomputed as well
+    for (const auto& v : inDegree) {
+        for (const auto& dep : providesTo(v.first)) {
+            ++inDegree[dep];
+        }
+    }
+
+    // Sort topologically to find evaluation order. Cells on a cycle never
+    // get ready and are left out.
+    // Also track the dependency level of each cell, cells of the same level
+    // do not depend on each other.
+    std::vector<CellAddress> makeOrder;
+    std::map<CellAddress, int> depth;
+    makeOrder.reserve(inDegree.size());
+    for (const auto& v : inDegree) {
+        if (v.second == 0) {
+            makeOrder.push_back(v.first);
+            depth[v.first] = 0;
+        }
+    }
+    for (std::size_t i = 0; i < makeOrder.size(); ++i) {
+        int level = depth[makeOrder[i]] + 1;
+        for (const auto& dep : providesTo(makeOrder[i])) {
+            int& d = depth[dep];
+            d = std::max(d, level);
+            if (--inDegree[dep] == 0) {
+                makeOrder.push_back(dep);
+            }
+        }
+    }
+
+    if (makeOrder.size() == inDegree.size()) {
+        // Recompute cells level by level
         FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
-            FC_TRACE(addr.toString());
-            recomputeCell(addr);
+        std::stable_sort(makeOrder.begin(),
+                         makeOrder.end(),
+                         [&depth](const CellAddress& a, const CellAddress& b) {
+                             return depth[a] < depth[b];
+                         });
+        std::vector<CellAddress> level;
+        for (const auto& addr : makeOrder) {
+            if (!level.empty() && depth[addr] != depth[level.front()]) {
+                recomputeLevel(level);
+                level.clear();
+            }
+            level.push_back(addr);
+        }
+        if (!level.empty()) {
+            recomputeLevel(level);
         }
     }
-    catch (std::exception&) {
-        for (auto& v : VertexList) {
+    else {
+        for (const auto& v : inDegree) {
             Cell* cell = cells.getValue(v.first);
             // Mark as erroneous
             if (cell) {
@@ -1640,9 +1876,9 @@ void Sheet::providesTo(CellAddress address, std::set<std::string>& result) const
  * @param result Set of links.
  */
 
-std::set<CellAddress> Sheet::providesTo(CellAddress address) const
+const std::set<CellAddress>& Sheet::providesTo(CellAddress address) const
 {
-    return cells.getDeps(getFullName() + "." + address.toString());
+    return cells.getCellDependants(address);
 }
 
 void Sheet::onDocumentRestored()
@@ -29,6 +29,7 @@
 #endif
 
 #include <map>
+#include <memory>
 #include <tuple>
 #include <set>
 #include <string>
@@ -39,6 +40,7 @@
 #include <App/FeaturePython.h>
 #include <App/PropertyUnits.h>
 #include <App/Range.h>
+#include <Base/Quantity.h>
 #include <Base/Unit.h>
 
 #include "PropertyColumnWidths.h"
@@ -246,17 +248,28 @@ protected:
 
     void updateColumnsOrRows(bool horizontal, int section, int count);
 
-    std::set<App::CellAddress> providesTo(App::CellAddress address) const;
+    const std::set<App::CellAddress>& providesTo(App::CellAddress address) const;
 
     void onDocumentRestored() override;
 
-    void recomputeCell(App::CellAddress p);
+    void recomputeCell(App::CellAddress p, std::unique_ptr<App::Expression> value = nullptr);
+
+    void recomputeLevel(const std::vector<App::CellAddress>& level);
+
+    bool isPlainArithmetic(const App::Expression* expr,
+                           std::map<const App::Expression*, App::CellAddress>& refs) const;
+
+    bool evaluatePlainArithmetic(const App::Expression* expr,
+                                 const std::map<const App::Expression*, App::CellAddress>& refs,
+                                 Base::Quantity& result) const;
 
     App::Property* getProperty(App::CellAddress key) const;
 
     App::Property* getProperty(const char* addr) const;
 
-    void updateProperty(App::CellAddress key);
+    void updateProperty(App::CellAddress key, std::unique_ptr<App::Expression> value = nullptr);
+
+    App::Property* setPropertyValue(App::CellAddress key, const App::Expression* value);
 
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
 
@@ -1576,6 +1576,56 @@ class SpreadsheetCases(unittest.TestCase):
         self.assertLess(abs(sheet.F4.Value - -1.6971), 0.0001)
         self.assertEqual(sheet.F5, FreeCAD.Vector(1.72, 2.96, 4.2))
 
+    def testReadCellDoesNotTouch(self):
+        """Reading computed cells must not modify the sheet"""
+        sheet = self.doc.addObject("Spreadsheet::Sheet", "Spreadsheet")
+        sheet.set("A1", "1")
+        sheet.set("A2", "=A1 + 1")
+        sheet.set("A3", "=2mm")
+        sheet.set("A4", "text")
+        sheet.set("B1", "=A2 * 2")
+        sheet.setAlias("B1", "total")
+        self.doc.recompute()
+        self.assertFalse("Touched" in sheet.State)
+
+        # every computed cell is listed, whether it was read before or not
+        for cell in ["A1", "A2", "A3", "A4", "B1"]:
+            self.assertTrue(cell in sheet.PropertiesList)
+
+        self.assertEqual(sheet.A1, 1)
+        self.assertEqual(sheet.get("A2"), 2)
+        self.assertEqual(sheet.getContents("A3"), "=2mm")
+        self.assertEqual(sheet.A3, Units.Quantity("2mm"))
+        self.assertEqual(getattr(sheet, "A4"), "text")
+        self.assertEqual(sheet.total, 4)
+        self.assertEqual(sheet.getPropertyByName("B1"), 4)
+        self.assertFalse("Touched" in sheet.State)
+
+    def testParallelCellReferences(self):
+        """Levels of plain arithmetic on other cells are large enough to be
+        evaluated in parallel"""
+        sheet = self.doc.addObject("Spreadsheet::Sheet", "Spreadsheet")
+        count = 200
+        sheet.set("E1", "3")
+        sheet.setAlias("E1", "factor")
+        for i in range(1, count + 1):
+            sheet.set("A{}".format(i), str(i))
+            sheet.set("B{}".format(i), "=A{0} * 2 + A{0} / 2".format(i))
+            sheet.set("C{}".format(i), "=-B{0} + factor * A{0}".format(i))
+            sheet.set("D{}".format(i), "=C{} * 1mm".format(i))
+        self.doc.recompute()
+
+        for i in range(1, count + 1):
+            self.assertEqual(getattr(sheet, "B{}".format(i)), 2.5 * i)
+            self.assertEqual(getattr(sheet, "C{}".format(i)), 0.5 * i)
+            length = Units.Quantity(0.5 * i, Units.Length)
+            self.assertEqual(getattr(sheet, "D{}".format(i)), length)
+
+        sheet.set("E1", "5")
+        self.doc.recompute()
+        for i in range(1, count + 1):
+            self.assertEqual(getattr(sheet, "C{}".format(i)), 2.5 * i)
+
     def tearDown(self):
         # closing doc
         FreeCAD.closeDocument(self.doc.Name)
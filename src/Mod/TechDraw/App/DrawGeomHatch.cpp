@@ -23,11 +23,15 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <cmath>
 # include <iomanip>
 # include <sstream>
 
 #include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
@@ -38,6 +42,8 @@
 #include <gp_Pnt.hxx>
 #include <Precision.hxx>
 #include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
 #include <TopoDS_Edge.hxx>
@@ -318,6 +324,36 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
     BRepBndLib::AddOptimal(face, bBox);
     bBox.SetGap(0.0);
 
+    //faces bounded by straight edges are clipped without the boolean operation
+    std::vector<HatchSegment> boundary;
+    if (getStraightBoundary(face, boundary)) {
+        for (auto& ls: lineSets) {
+            PATLineSpec hl = ls.getPATLineSpec();
+            std::vector<HatchSegment> lines = makeLineOverlay(hl, bBox, scale);
+            transformSegments(lines, hatchRotation, hatchOffset);
+            std::vector<HatchSegment> clipped = clipSegments(lines, boundary);
+
+            std::vector<TopoDS_Edge> resultEdges;
+            std::vector<TechDraw::BaseGeomPtr> resultGeoms;
+            resultEdges.reserve(clipped.size());
+            resultGeoms.reserve(clipped.size());
+            Bnd_Box overlayBox;
+            overlayBox.SetGap(0.0);
+            for (auto& segment : clipped) {
+                overlayBox.Add(DU::to<gp_Pnt>(segment.first));
+                overlayBox.Add(DU::to<gp_Pnt>(segment.second));
+                TopoDS_Edge edge = makeLine(segment.first, segment.second);
+                resultEdges.push_back(edge);
+                resultGeoms.push_back(std::make_shared<TechDraw::Generic>(edge));
+            }
+            ls.setBBox(overlayBox);
+            ls.setEdges(resultEdges);
+            ls.setGeoms(resultGeoms);
+            result.push_back(ls);
+        }
+        return result;
+    }
+
     for (auto& ls: lineSets) {
         PATLineSpec hl = ls.getPATLineSpec();
         std::vector<TopoDS_Edge> candidates = DrawGeomHatch::makeEdgeOverlay(hl, bBox, scale);   //completely cover face bbox with lines
@@ -387,10 +423,21 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
 
 /* static */
 std::vector<TopoDS_Edge> DrawGeomHatch::makeEdgeOverlay(PATLineSpec hatchLine, Bnd_Box bBox, double scale)
+{
+    std::vector<TopoDS_Edge> result;
+    for (auto& line : makeLineOverlay(hatchLine, bBox, scale)) {
+        result.push_back(makeLine(line.first, line.second));
+    }
+    return result;
+}
+
+//! the end points of the lines that completely cover bBox with the hatch pattern
+/* static */
+std::vector<HatchSegment> DrawGeomHatch::makeLineOverlay(PATLineSpec hatchLine, Bnd_Box bBox, double scale)
 {
     constexpr double RightAngleDegrees{90.0};
     constexpr double HalfCircleDegrees{180.0};
-    std::vector<TopoDS_Edge> result;
+    std::vector<HatchSegment> result;
 
     double minX, maxX, minY, maxY, minZ, maxZ;
     bBox.Get(minX, minY, minZ, maxX, maxY, maxZ);
@@ -430,8 +477,7 @@ std::vector<TopoDS_Edge> DrawGeomHatch::makeEdgeOverlay(PATLineSpec hatchLine, B
         for (int i = 0; i < repeatTotal; i++) {
             Base::Vector3d newStart(minX, yStart + float(i)*interval, 0);
             Base::Vector3d newEnd(maxX, yStart + float(i)*interval, 0);
-            TopoDS_Edge newLine = makeLine(newStart, newEnd);
-            result.push_back(newLine);
+            result.emplace_back(newStart, newEnd);
         }
     } else if (angle == RightAngleDegrees ||
                angle == -RightAngleDegrees) {         //odd case 2: vertical lines
@@ -446,8 +492,7 @@ std::vector<TopoDS_Edge> DrawGeomHatch::makeEdgeOverlay(PATLineSpec hatchLine, B
         for (int i = 0; i < repeatTotal; i++) {
             Base::Vector3d newStart(xStart + float(i)*interval, minY, 0);
             Base::Vector3d newEnd(xStart + float(i)*interval, maxY, 0);
-            TopoDS_Edge newLine = makeLine(newStart, newEnd);
-            result.push_back(newLine);
+            result.emplace_back(newStart, newEnd);
         }
 //TODO: check if this makes 2-3 extra lines.  might be some "left" lines on "right" side of vv
     } else if (angle > 0) {      //oblique  (bottom left -> top right)
@@ -467,8 +512,7 @@ std::vector<TopoDS_Edge> DrawGeomHatch::makeEdgeOverlay(PATLineSpec hatchLine, B
         for (int i = 0; i < repeatTotal; i++) {
             Base::Vector3d newStart(leftStartX + (float(i) *  interval), minY, 0);
             Base::Vector3d newEnd (leftEndX + (float(i) * interval), maxY, 0);
-            TopoDS_Edge newLine = makeLine(newStart, newEnd);
-            result.push_back(newLine);
+            result.emplace_back(newStart, newEnd);
         }
     } else {    //oblique (bottom right -> top left)
         // ex: -60, 0,0, 0,4.0, 25.0, -12.5, 12.5, -6
@@ -485,14 +529,121 @@ std::vector<TopoDS_Edge> DrawGeomHatch::makeEdgeOverlay(PATLineSpec hatchLine, B
         for (int i = 0; i < repeatTotal; i++) {
             Base::Vector3d newStart(leftStartX + float(i)*interval, minY, 0);
             Base::Vector3d newEnd(leftEndX + float(i)*interval, maxY, 0);
-            TopoDS_Edge newLine = makeLine(newStart, newEnd);
-            result.push_back(newLine);
+            result.emplace_back(newStart, newEnd);
         }
     }
 
     return result;
 }
 
+//! collect the boundary of face as 2d segments if every edge of the face is a straight line.
+//! returns false if the face has any curved edges.
+/* static */
+bool DrawGeomHatch::getStraightBoundary(const TopoDS_Face& face, std::vector<HatchSegment>& boundary)
+{
+    boundary.clear();
+    for (TopExp_Explorer expl(face, TopAbs_EDGE); expl.More(); expl.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(expl.Current());
+        if (BRep_Tool::Degenerated(edge)) {
+            continue;
+        }
+        BRepAdaptor_Curve adapt(edge);
+        if (adapt.GetType() != GeomAbs_Line) {
+            boundary.clear();
+            return false;
+        }
+        gp_Pnt start = adapt.Value(adapt.FirstParameter());
+        gp_Pnt end = adapt.Value(adapt.LastParameter());
+        boundary.emplace_back(Base::Vector3d(start.X(), start.Y(), 0.0),
+                              Base::Vector3d(end.X(), end.Y(), 0.0));
+    }
+    return !boundary.empty();
+}
+
+//! apply the pattern rotation (degrees, about the origin) and offset to the segments
+/* static */
+void DrawGeomHatch::transformSegments(std::vector<HatchSegment>& segments, double hatchRotation,
+                                      Base::Vector3d hatchOffset)
+{
+    double cosA = 1.0;
+    double sinA = 0.0;
+    if (hatchRotation != 0.0) {
+        double hatchRotationRad = hatchRotation * M_PI / 180.0;
+        cosA = cos(hatchRotationRad);
+        sinA = sin(hatchRotationRad);
+    }
+    auto transform = [&](Base::Vector3d& point) {
+        double x = point.x * cosA - point.y * sinA;
+        double y = point.x * sinA + point.y * cosA;
+        point = Base::Vector3d(x + hatchOffset.x, y + hatchOffset.y, 0.0);
+    };
+    for (auto& segment : segments) {
+        transform(segment.first);
+        transform(segment.second);
+    }
+}
+
+//! clip the hatch lines to the inside of the closed boundary using the even-odd rule.  The
+//! boundary is kept in separate coordinate arrays so the crossing test over all boundary segments
+//! is a simple loop the compiler can vectorize.
+/* static */
+std::vector<HatchSegment> DrawGeomHatch::clipSegments(const std::vector<HatchSegment>& lines,
+                                                      const std::vector<HatchSegment>& boundary)
+{
+    std::vector<HatchSegment> result;
+    size_t count = boundary.size();
+    std::vector<double> ax(count), ay(count), bx(count), by(count);
+    for (size_t i = 0; i < count; i++) {
+        ax[i] = boundary[i].first.x;
+        ay[i] = boundary[i].first.y;
+        bx[i] = boundary[i].second.x;
+        by[i] = boundary[i].second.y;
+    }
+
+    std::vector<double> distA(count), distB(count);
+    std::vector<double> params;
+    for (auto& line : lines) {
+        double sx = line.first.x;
+        double sy = line.first.y;
+        double dx = line.second.x - sx;
+        double dy = line.second.y - sy;
+        double lengthSq = dx * dx + dy * dy;
+        if (lengthSq < Precision::SquareConfusion()) {
+            continue;
+        }
+
+        //signed distances (scaled by the line length) of the boundary ends from the line
+        for (size_t i = 0; i < count; i++) {
+            distA[i] = dx * (ay[i] - sy) - dy * (ax[i] - sx);
+            distB[i] = dx * (by[i] - sy) - dy * (bx[i] - sx);
+        }
+
+        params.clear();
+        for (size_t i = 0; i < count; i++) {
+            //half open test, so a crossing through a boundary vertex is only counted once
+            if ((distA[i] > 0.0) == (distB[i] > 0.0)) {
+                continue;
+            }
+            double ratio = distA[i] / (distA[i] - distB[i]);
+            double px = ax[i] + (bx[i] - ax[i]) * ratio;
+            double py = ay[i] + (by[i] - ay[i]) * ratio;
+            params.push_back(((px - sx) * dx + (py - sy) * dy) / lengthSq);
+        }
+        std::sort(params.begin(), params.end());
+
+        for (size_t i = 0; i + 1 < params.size(); i += 2) {
+            double first = std::max(0.0, params[i]);
+            double last = std::min(1.0, params[i + 1]);
+            if ((last - first) * sqrt(lengthSq) < Precision::Confusion()) {
+                continue;
+            }
+            result.emplace_back(Base::Vector3d(sx + first * dx, sy + first * dy, 0.0),
+                                Base::Vector3d(sx + last * dx, sy + last * dy, 0.0));
+        }
+    }
+    return result;
+}
+
 TopoDS_Edge DrawGeomHatch::makeLine(Base::Vector3d s, Base::Vector3d e)
 {
     gp_Pnt start(s.x, s.y, 0.0);
@@ -95,7 +95,14 @@ public:
 
     static std::vector<TopoDS_Edge> makeEdgeOverlay(PATLineSpec hatchLine, Bnd_Box bBox,
                                     double scale);
+    static std::vector<HatchSegment> makeLineOverlay(PATLineSpec hatchLine, Bnd_Box bBox,
+                                                     double scale);
     static TopoDS_Edge makeLine(Base::Vector3d start, Base::Vector3d end);
+    static bool getStraightBoundary(const TopoDS_Face& face, std::vector<HatchSegment>& boundary);
+    static void transformSegments(std::vector<HatchSegment>& segments, double hatchRotation,
+                                  Base::Vector3d hatchOffset);
+    static std::vector<HatchSegment> clipSegments(const std::vector<HatchSegment>& lines,
+                                                  const std::vector<HatchSegment>& boundary);
     static std::vector<PATLineSpec> getDecodedSpecsFromFile(std::string fileSpec, std::string myPattern);
     static TopoDS_Face extractFace(DrawViewPart* source, int iface );
     static std::string prefGeomHatchFile();
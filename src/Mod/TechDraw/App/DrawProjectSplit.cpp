@@ -25,8 +25,11 @@
 #ifndef _PreComp_
 # include <algorithm>
 # include <limits>
+# include <numeric>
 # include <sstream>
 #include <Bnd_Box.hxx>
+#include <Bnd_BoundSortBox.hxx>
+#include <Bnd_HArray1OfBox.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
@@ -43,8 +46,10 @@
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TColStd_ListIteratorOfListOfInteger.hxx>
 #endif
 #include <BOPAlgo_Builder.hxx>
+#include <QtConcurrentMap>
 
 #include <Base/Console.h>
 #include <Base/Parameter.h>
@@ -124,13 +129,17 @@ TechDraw::GeometryObjectPtr DrawProjectSplit::buildGeometryObject(TopoDS_Shape s
 //this routine is the big time consumer.  gets called many times (and is slow?))
 //note param gets modified here
 bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, bool allowEnds)
+{
+    return isOnEdge(e, getEdgeBox(e), v, param, allowEnds);
+}
+
+//! as above, but using a previously calculated (see getEdgeBox) bounding box for the edge
+bool DrawProjectSplit::isOnEdge(const TopoDS_Edge& e, const Bnd_Box& sBox, const TopoDS_Vertex& v,
+                                double& param, bool allowEnds)
 {
     param = -2;
 
     //eliminate obvious cases
-    Bnd_Box sBox;
-    BRepBndLib::AddOptimal(e, sBox);
-    sBox.SetGap(0.1);
     if (!sBox.IsVoid()) {
         gp_Pnt pt = BRep_Tool::Pnt(v);
         if (sBox.IsOut(pt)) {
@@ -163,6 +172,100 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
     return false;
 }
 
+//! the bounding box used for the edge in isOnEdge and findSplitPoints
+Bnd_Box DrawProjectSplit::getEdgeBox(const TopoDS_Edge& e)
+{
+    Bnd_Box box;
+    BRepBndLib::AddOptimal(e, box);
+    box.SetGap(0.1);
+    return box;
+}
+
+//! HLR algo does not provide all edge intersections for edge endpoints, so we need to find where
+//! long edges are touched by a vertex of another edge.  The edge boxes are calculated once and
+//! put in a spatial index, so only edges with overlapping boxes are compared, and the edges are
+//! processed in parallel.  The result is in the same order as a plain nested loop over the edges
+//! would produce it.
+std::vector<splitPoint> DrawProjectSplit::findSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    std::vector<splitPoint> result;
+    int edgeCount = static_cast<int>(edges.size());
+    if (edgeCount < 2) {
+        return result;
+    }
+
+    std::vector<Bnd_Box> boxes(edgeCount);
+    std::vector<bool> usable(edgeCount, false);
+    Bnd_Box allBoxes;
+    Handle(Bnd_HArray1OfBox) boxArray = new Bnd_HArray1OfBox(0, edgeCount - 1);
+    for (int i = 0; i < edgeCount; i++) {
+        usable[i] = !DrawUtil::isZeroEdge(edges[i]);
+        if (usable[i]) {
+            boxes[i] = getEdgeBox(edges[i]);
+            usable[i] = !boxes[i].IsVoid();
+        }
+        if (usable[i]) {
+            boxArray->SetValue(i, boxes[i]);
+            allBoxes.Add(boxes[i]);
+        }
+    }
+    if (allBoxes.IsVoid()) {
+        return result;
+    }
+
+    Bnd_BoundSortBox boxIndex;
+    boxIndex.Initialize(allBoxes, boxArray);
+
+    //Bnd_BoundSortBox::Compare is not reentrant, so the candidates are collected up front
+    std::vector<std::vector<int>> candidates(edgeCount);
+    for (int iOuter = 0; iOuter < edgeCount; iOuter++) {
+        if (!usable[iOuter]) {
+            continue;
+        }
+        const TColStd_ListOfInteger& hits = boxIndex.Compare(boxes[iOuter]);
+        for (TColStd_ListIteratorOfListOfInteger it(hits); it.More(); it.Next()) {
+            int iInner = it.Value();
+            if (iInner != iOuter && usable[iInner] && !boxes[iOuter].IsOut(boxes[iInner])) {
+                candidates[iOuter].push_back(iInner);
+            }
+        }
+        std::sort(candidates[iOuter].begin(), candidates[iOuter].end());
+    }
+
+    std::vector<std::vector<splitPoint>> found(edgeCount);
+    std::vector<int> outerIndices(edgeCount);
+    std::iota(outerIndices.begin(), outerIndices.end(), 0);
+    auto findForOuter = [&](int& iOuter) {
+        TopoDS_Vertex v1 = TopExp::FirstVertex(edges[iOuter]);
+        TopoDS_Vertex v2 = TopExp::LastVertex(edges[iOuter]);
+        for (int iInner : candidates[iOuter]) {
+            double param = -1;
+            if (isOnEdge(edges[iInner], boxes[iInner], v1, param, false)) {
+                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
+                splitPoint s1;
+                s1.i = iInner;
+                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
+                s1.param = param;
+                found[iOuter].push_back(s1);
+            }
+            if (isOnEdge(edges[iInner], boxes[iInner], v2, param, false)) {
+                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
+                splitPoint s2;
+                s2.i = iInner;
+                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
+                s2.param = param;
+                found[iOuter].push_back(s2);
+            }
+        }
+    };
+    QtConcurrent::blockingMap(outerIndices, findForOuter);
+
+    for (auto& splits : found) {
+        result.insert(result.end(), splits.begin(), splits.end());
+    }
+    return result;
+}
+
 
 std::vector<TopoDS_Edge> DrawProjectSplit::splitEdges(std::vector<TopoDS_Edge> edges, std::vector<splitPoint> splits)
 {
@@ -592,14 +695,42 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
     int edgeCount = inEdges.size();
+    if (edgeCount == 0) {
+        return outEdges;
+    }
+
+    //boxes are calculated once and indexed, so we only test pairs that could overlap
+    std::vector<Bnd_Box> boxes(edgeCount);
+    Bnd_Box allBoxes;
+    Handle(Bnd_HArray1OfBox) boxArray = new Bnd_HArray1OfBox(0, edgeCount - 1);
+    for (int i = 0; i < edgeCount; i++) {
+        BRepBndLib::Add(inEdges.at(i), boxes[i]);
+        boxes[i].SetGap(0.1);           //generous, same as boxesIntersect
+        boxArray->SetValue(i, boxes[i]);
+        allBoxes.Add(boxes[i]);
+    }
+    Bnd_BoundSortBox boxIndex;
+    if (!allBoxes.IsVoid()) {
+        boxIndex.Initialize(allBoxes, boxArray);
+    }
+
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
-        if (skipThisEdge.at(ie0)) {
+        if (skipThisEdge.at(ie0) || boxes[ie0].IsVoid()) {
             continue;
         }
-        int ie1 = ie0 + 1;
-        for (; ie1 < edgeCount; ie1++) {
-            if (skipThisEdge.at(ie1)) {
+        //keep the original pairing order so the result does not change
+        std::vector<int> candidates;
+        const TColStd_ListOfInteger& hits = boxIndex.Compare(boxes[ie0]);
+        for (TColStd_ListIteratorOfListOfInteger it(hits); it.More(); it.Next()) {
+            if (it.Value() > ie0) {
+                candidates.push_back(it.Value());
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (int ie1 : candidates) {
+            if (skipThisEdge.at(ie1) || boxes[ie0].IsOut(boxes[ie1])) {
                 continue;
             }
             int rc = isSubset(inEdges.at(ie0), inEdges.at(ie1));
@@ -562,6 +562,12 @@ bool DrawViewDimension::okToProceed()
         return false;
     }
 
+    if (getViewPart()->isShowingPreview()) {
+        // the references point to the exact geometry. Selection and the dimension commands are
+        // blocked while the preview is shown, so no reference can point into the preview.
+        return false;
+    }
+
     // is this check still relevant or is it replaced by the autocorrect and
     // validate methods?
     if (References3D.getValues().empty() && !checkReferences2D()) {
@@ -102,7 +102,9 @@ DrawViewPart::DrawViewPart()
       m_handleFaces(false),
       nowUnsetting(false),
       m_waitingForFaces(false),
-      m_waitingForHlr(false)
+      m_waitingForHlr(false),
+      m_hlrCycle(0),
+      m_previewCycle(0)
 {
     static const char* group = "Projection";
     static const char* sgroup = "HLR Parameters";
@@ -163,6 +165,9 @@ DrawViewPart::~DrawViewPart()
         Base::Console().Message("%s is waiting for face finding to finish\n", Label.getValue());
         m_faceFuture.waitForFinished();
     }
+    if (m_previewFuture.isRunning()) {
+        m_previewFuture.waitForFinished();
+    }
     removeAllReferencesFromGeom();
 }
 
@@ -351,6 +356,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
     go->setScrubCount(ScrubCount.getValue());
+    go->setHlrCacheSize(Preferences::hlrCacheSize());
 
     if (CoarseView.getValue()) {
         //the polygon approximation HLR process runs quickly, so doesn't need to be in a
@@ -372,10 +378,80 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         m_hlrFuture = QtConcurrent::run(std::move(lambda));
         m_hlrWatcher.setFuture(m_hlrFuture);
         waitingForHlr(true);
+        m_hlrCycle++;
+
+        if (Preferences::previewWithPolygonHLR()) {
+            startPreview(shape, viewAxis);
+        }
     }
     return go;
 }
 
+//! run the polygon HLR algo in another thread so we have something to show while the exact
+//! HLR is running.  The preview is only used if it arrives before the exact result.
+void DrawViewPart::startPreview(const TopoDS_Shape& shape, const gp_Ax2& viewAxis)
+{
+    if (m_previewFuture.isRunning()) {
+        //still working on the preview for an earlier cycle
+        return;
+    }
+
+    TechDraw::GeometryObjectPtr pgo(
+        std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
+    pgo->isPerspective(Perspective.getValue());
+    pgo->setFocus(Focus.getValue());
+    pgo->usePolygonHLR(true);
+    m_previewGeometryObject = pgo;
+    m_previewCycle = m_hlrCycle;
+
+    connectPreviewWatcher = QObject::connect(&m_previewWatcher, &QFutureWatcherBase::finished,
+                                             &m_previewWatcher, [this] { this->onPreviewFinished(); });
+
+    // the polygon algo meshes its input, so it works on its own copy of the shape to avoid
+    // modifying the shape the exact HLR is reading in the other thread.
+    auto lambda = [pgo, shape, viewAxis]{
+        try {
+            BRepBuilderAPI_Copy copier(shape, true, false);
+            pgo->projectShapeWithPolygonAlgo(copier.Shape(), viewAxis);
+        }
+        catch (Standard_Failure& e) {
+            Base::Console().Log("DVP::startPreview - polygon HLR failed - %s\n", e.GetMessageString());
+            pgo->clear();
+        }
+        catch (Base::Exception& e) {
+            Base::Console().Log("DVP::startPreview - polygon HLR failed - %s\n", e.what());
+            pgo->clear();
+        }
+    };
+    m_previewFuture = QtConcurrent::run(std::move(lambda));
+    m_previewWatcher.setFuture(m_previewFuture);
+}
+
+//! show the polygon HLR preview until the exact result replaces it in onHlrFinished.  The
+//! preview is display only: no faces, cosmetics or dimension updates are based on it, so
+//! dimension references are only checked (and repaired by the GeometryMatcher if needed) against
+//! the exact geometry.
+void DrawViewPart::onPreviewFinished()
+{
+    //    Base::Console().Message("DVP::onPreviewFinished() - %s\n", getNameInDocument());
+    QObject::disconnect(connectPreviewWatcher);
+    TechDraw::GeometryObjectPtr preview = m_previewGeometryObject;
+    m_previewGeometryObject = nullptr;
+
+    if (!preview || !waitingForHlr() || m_previewCycle != m_hlrCycle) {
+        //the exact result is already here, or this preview is for an older cycle
+        return;
+    }
+    if (preview->getEdgeGeometry().empty()) {
+        return;
+    }
+
+    geometryObject = preview;
+    bbox = geometryObject->calcBoundingBox();
+    showProgressMessage(getNameInDocument(), "is showing a preview");
+    requestPaint();
+}
+
 //! continue processing after hlr thread completes
 void DrawViewPart::onHlrFinished()
 {
@@ -599,60 +675,7 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
@@ -1034,6 +1057,12 @@ bool DrawViewPart::waitingForResult() const
     return false;
 }
 
+//! true if the current geometry is the polygon HLR preview of an exact HLR still in progress
+bool DrawViewPart::isShowingPreview() const
+{
+    return geometryObject && geometryObject->usePolygonHLR() && !CoarseView.getValue();
+}
+
 bool DrawViewPart::hasGeometry() const
 {
     if (!geometryObject) {
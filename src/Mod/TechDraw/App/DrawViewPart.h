@@ -211,11 +211,13 @@ public:
     bool waitingForHlr() const { return m_waitingForHlr; }
     void waitingForHlr(bool s) { m_waitingForHlr = s; }
     virtual bool waitingForResult() const;
+    bool isShowingPreview() const;
     void progressValueChanged(int v);
 
 public Q_SLOTS:
     void onHlrFinished(void);
     void onFacesFinished(void);
+    void onPreviewFinished(void);
 
 protected:
     bool checkXDirection() const;
@@ -230,6 +232,7 @@ protected:
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(TopoDS_Shape& shape,
                                                             const gp_Ax2& viewAxis);
     virtual TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape);//const??
+    void startPreview(const TopoDS_Shape& shape, const gp_Ax2& viewAxis);
     void partExec(TopoDS_Shape& shape);
     virtual void addPoints(void);
 
@@ -257,6 +260,12 @@ private:
     QMetaObject::Connection connectFaceWatcher;
     QFutureWatcher<void> m_faceWatcher;
     QFuture<void> m_faceFuture;
+    QMetaObject::Connection connectPreviewWatcher;
+    QFutureWatcher<void> m_previewWatcher;
+    QFuture<void> m_previewFuture;
+    TechDraw::GeometryObjectPtr m_previewGeometryObject;
+    int m_hlrCycle;
+    int m_previewCycle;
 
 };
 
@@ -73,6 +73,7 @@
 #include "DrawViewDetail.h"
 #include "DrawViewPart.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "DrawProjectSplit.h"
 #include "ShapeUtils.h"
 
@@ -83,7 +84,7 @@ using DU = DrawUtil;
 
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj)
     : m_parentName(parent), m_parent(parentObj), m_isoCount(0), m_isPersp(false), m_focus(100.0),
-      m_usePolygonHLR(false), m_scrubCount(0)
+      m_usePolygonHLR(false), m_scrubCount(0), m_hlrCacheSize(0)
 
 {}
 
@@ -144,6 +145,27 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
 {
     clear();
 
+    //views of an unchanged shape in an unchanged direction can reuse an earlier result
+    HLRKey cacheKey;
+    if (m_hlrCacheSize > 0) {
+        cacheKey = HLRCache::makeKey(inShape, viewAxis, m_isoCount, m_isPersp, m_focus);
+        HLRResult cached;
+        if (HLRCache::instance().find(cacheKey, cached)) {
+            visHard = cached.visHard;
+            visOutline = cached.visOutline;
+            visSmooth = cached.visSmooth;
+            visSeam = cached.visSeam;
+            visIso = cached.visIso;
+            hidHard = cached.hidHard;
+            hidOutline = cached.hidOutline;
+            hidSmooth = cached.hidSmooth;
+            hidSeam = cached.hidSeam;
+            hidIso = cached.hidIso;
+            makeTDGeometry();
+            return;
+        }
+    }
+
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
@@ -244,6 +266,21 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
             "GeometryObject::projectShape - unknown error occurred while extracting edges");
     }
 
+    if (m_hlrCacheSize > 0) {
+        HLRResult result;
+        result.visHard = visHard;
+        result.visOutline = visOutline;
+        result.visSmooth = visSmooth;
+        result.visSeam = visSeam;
+        result.visIso = visIso;
+        result.hidHard = hidHard;
+        result.hidOutline = hidOutline;
+        result.hidSmooth = hidSmooth;
+        result.hidSeam = hidSeam;
+        result.hidIso = hidIso;
+        HLRCache::instance().add(cacheKey, result, m_hlrCacheSize);
+    }
+
     makeTDGeometry();
 }
 
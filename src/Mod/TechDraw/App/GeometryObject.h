@@ -98,6 +98,7 @@ public:
     void setFocus(double f) { m_focus = f; }
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
+    void setHlrCacheSize(int size) { m_hlrCacheSize = size; }
 
 
     void pruneVertexGeom(Base::Vector3d center, double radius);
@@ -165,6 +166,7 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+    int m_hlrCacheSize;
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
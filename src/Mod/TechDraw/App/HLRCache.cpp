@@ -0,0 +1,241 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_BezierCurve.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <gp_Pnt.hxx>
+#endif
+
+#include "HLRCache.h"
+
+using namespace TechDraw;
+
+namespace
+{
+
+using Fingerprint = std::vector<long long>;
+
+void addValue(Fingerprint& data, std::size_t value)
+{
+    data.push_back(static_cast<long long>(value));
+}
+
+//! values are rounded so that the fingerprint survives a copy of the shape, but not a real edit
+void addValue(Fingerprint& data, double value)
+{
+    constexpr double resolution {1.0e7};
+    data.push_back(std::llround(value * resolution));
+}
+
+void addValue(Fingerprint& data, const gp_Pnt& point)
+{
+    addValue(data, point.X());
+    addValue(data, point.Y());
+    addValue(data, point.Z());
+}
+
+void addValue(Fingerprint& data, const TColgp_Array1OfPnt& poles)
+{
+    for (int i = poles.Lower(); i <= poles.Upper(); i++) {
+        addValue(data, poles(i));
+    }
+}
+
+void addValue(Fingerprint& data, const TColgp_Array2OfPnt& poles)
+{
+    for (int i = poles.LowerRow(); i <= poles.UpperRow(); i++) {
+        for (int j = poles.LowerCol(); j <= poles.UpperCol(); j++) {
+            addValue(data, poles(i, j));
+        }
+    }
+}
+
+//! free-form surfaces contribute their control points, all surfaces are sampled on a grid over
+//! the parameter range of the face so that e.g. a changed radius is noticed as well
+void addSurface(Fingerprint& data, const TopoDS_Face& face)
+{
+    BRepAdaptor_Surface adapt(face);
+    addValue(data, static_cast<std::size_t>(adapt.GetType()));
+    if (adapt.GetType() == GeomAbs_BSplineSurface) {
+        addValue(data, adapt.BSpline()->Poles());
+    }
+    else if (adapt.GetType() == GeomAbs_BezierSurface) {
+        addValue(data, adapt.Bezier()->Poles());
+    }
+
+    constexpr int samples {3};
+    double uMin {0.0};
+    double uMax {0.0};
+    double vMin {0.0};
+    double vMax {0.0};
+    BRepTools::UVBounds(face, uMin, uMax, vMin, vMax);
+    for (int i = 0; i < samples; i++) {
+        double u = uMin + (uMax - uMin) * (i + 0.5) / samples;
+        for (int j = 0; j < samples; j++) {
+            double v = vMin + (vMax - vMin) * (j + 0.5) / samples;
+            addValue(data, adapt.Value(u, v));
+        }
+    }
+}
+
+void addCurve(Fingerprint& data, const TopoDS_Edge& edge)
+{
+    BRepAdaptor_Curve adapt(edge);
+    addValue(data, static_cast<std::size_t>(adapt.GetType()));
+    if (adapt.GetType() == GeomAbs_BSplineCurve) {
+        addValue(data, adapt.BSpline()->Poles());
+    }
+    else if (adapt.GetType() == GeomAbs_BezierCurve) {
+        addValue(data, adapt.Bezier()->Poles());
+    }
+
+    double first = adapt.FirstParameter();
+    double last = adapt.LastParameter();
+    addValue(data, adapt.Value(first + (last - first) / 3.0));
+    addValue(data, adapt.Value(first + 2.0 * (last - first) / 3.0));
+}
+
+bool sameAxis(const gp_Ax2& ax1, const gp_Ax2& ax2)
+{
+    constexpr double tolerance {1.0e-12};
+    return ax1.Location().IsEqual(ax2.Location(), tolerance)
+        && ax1.Direction().XYZ().IsEqual(ax2.Direction().XYZ(), tolerance)
+        && ax1.XDirection().XYZ().IsEqual(ax2.XDirection().XYZ(), tolerance);
+}
+
+}// namespace
+
+//! the hash only rejects most mismatches quickly, a hit compares the whole fingerprint so that a
+//! hash collision can't return the projection of a different shape
+bool HLRKey::operator==(const HLRKey& other) const
+{
+    return shapeHash == other.shapeHash && faceCount == other.faceCount
+        && edgeCount == other.edgeCount && vertexCount == other.vertexCount
+        && isoCount == other.isoCount && isPersp == other.isPersp
+        && (!isPersp || focus == other.focus) && sameAxis(viewAxis, other.viewAxis)
+        && fingerprint == other.fingerprint;
+}
+
+HLRCache& HLRCache::instance()
+{
+    static HLRCache inst;
+    return inst;
+}
+
+//! the shape part of the key is a fingerprint of the geometry rather than of the TShape, since
+//! the source shape is copied for every execute of a view.  It holds the rounded vertex
+//! positions, edge curves and face surfaces (control points and a grid of samples), which is
+//! cheap compared to HLR and changes whenever the geometry does, even if the topology stays the
+//! same.
+HLRKey HLRCache::makeKey(const TopoDS_Shape& inShape,
+                         const gp_Ax2& viewAxis,
+                         int isoCount,
+                         bool isPersp,
+                         double focus)
+{
+    HLRKey key;
+    key.viewAxis = viewAxis;
+    key.isoCount = isoCount;
+    key.isPersp = isPersp;
+    key.focus = focus;
+
+    Fingerprint& data = key.fingerprint;
+    for (TopExp_Explorer expl(inShape, TopAbs_FACE); expl.More(); expl.Next()) {
+        addSurface(data, TopoDS::Face(expl.Current()));
+        addValue(data, static_cast<std::size_t>(expl.Current().Orientation()));
+        key.faceCount++;
+    }
+    for (TopExp_Explorer expl(inShape, TopAbs_EDGE); expl.More(); expl.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(expl.Current());
+        if (BRep_Tool::Degenerated(edge)) {
+            continue;
+        }
+        addCurve(data, edge);
+        addValue(data, static_cast<std::size_t>(edge.Orientation()));
+        key.edgeCount++;
+    }
+    for (TopExp_Explorer expl(inShape, TopAbs_VERTEX); expl.More(); expl.Next()) {
+        addValue(data, BRep_Tool::Pnt(TopoDS::Vertex(expl.Current())));
+        key.vertexCount++;
+    }
+
+    std::size_t seed {data.size()};
+    for (long long value : data) {
+        seed ^= std::hash<long long>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    key.shapeHash = seed;
+    return key;
+}
+
+bool HLRCache::find(const HLRKey& key, HLRResult& result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->first == key) {
+            result = it->second;
+            m_entries.splice(m_entries.begin(), m_entries, it);
+            return true;
+        }
+    }
+    return false;
+}
+
+//! maxEntries is passed in by the caller since the preferences are not read from worker threads
+void HLRCache::add(const HLRKey& key, const HLRResult& result, int maxEntries)
+{
+    auto maxSize = static_cast<std::size_t>(std::max(0, maxEntries));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (maxSize == 0) {
+        m_entries.clear();
+        return;
+    }
+    m_entries.remove_if([&key](const std::pair<HLRKey, HLRResult>& entry) {
+        return entry.first == key;
+    });
+    m_entries.emplace_front(key, result);
+    while (m_entries.size() > maxSize) {
+        m_entries.pop_back();
+    }
+}
+
+void HLRCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
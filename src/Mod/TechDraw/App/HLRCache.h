@@ -0,0 +1,102 @@
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef TECHDRAW_HLRCACHE_H
+#define TECHDRAW_HLRCACHE_H
+
+//! a cache of exact HLR results shared by all the views in a session.  Views of
+//  an unchanged shape in an unchanged direction reuse the previous result instead
+//  of running HLRBRep_Algo again.
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax2.hxx>
+
+
+namespace TechDraw
+{
+
+//! the edge compounds produced by HLRBRep_HLRToShape for one projection
+struct TechDrawExport HLRResult
+{
+    TopoDS_Shape visHard;
+    TopoDS_Shape visOutline;
+    TopoDS_Shape visSmooth;
+    TopoDS_Shape visSeam;
+    TopoDS_Shape visIso;
+    TopoDS_Shape hidHard;
+    TopoDS_Shape hidOutline;
+    TopoDS_Shape hidSmooth;
+    TopoDS_Shape hidSeam;
+    TopoDS_Shape hidIso;
+};
+
+//! identifies one projection: a fingerprint of the (already centered, scaled and
+//! rotated) input shape plus every parameter that is passed to HLRBRep_Algo.
+struct TechDrawExport HLRKey
+{
+    std::vector<long long> fingerprint;
+    std::size_t shapeHash {0};
+    std::size_t faceCount {0};
+    std::size_t edgeCount {0};
+    std::size_t vertexCount {0};
+    gp_Ax2 viewAxis;
+    int isoCount {0};
+    bool isPersp {false};
+    double focus {0.0};
+
+    bool operator==(const HLRKey& other) const;
+};
+
+class TechDrawExport HLRCache
+{
+public:
+    static HLRCache& instance();
+
+    //! build the key for projecting inShape along viewAxis
+    static HLRKey makeKey(const TopoDS_Shape& inShape,
+                          const gp_Ax2& viewAxis,
+                          int isoCount,
+                          bool isPersp,
+                          double focus);
+
+    bool find(const HLRKey& key, HLRResult& result);
+    void add(const HLRKey& key, const HLRResult& result, int maxEntries);
+    void clear();
+
+private:
+    HLRCache() = default;
+
+    std::mutex m_mutex;
+    //most recently used entry first
+    std::list<std::pair<HLRKey, HLRResult>> m_entries;
+};
+
+}//namespace TechDraw
+
+#endif
@@ -26,6 +26,7 @@
 #define TechDraw_HATCHLINE_H_
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <Bnd_Box.hxx>
@@ -47,6 +48,9 @@ namespace TechDraw
 class DrawViewPart;
 class DrawUtil;
 
+//! start and end point of a straight hatch line segment
+using HatchSegment = std::pair<Base::Vector3d, Base::Vector3d>;
+
 //DashSpec is the parsed portion of a PATLineSpec related to mark/space/dot
 class TechDrawExport DashSpec
 {
@@ -692,3 +692,16 @@ bool Preferences::showUnits()
 }
 
 
+//! the number of HLR results kept in memory for reuse by unchanged views. 0 disables the cache.
+int Preferences::hlrCacheSize()
+{
+    return getPreferenceGroup("General")->GetInt("HLRCacheSize", 32);
+}
+
+//! if true, views using the exact HLR algorithm show a quick polygonal HLR result while the
+//! exact result is being calculated.
+bool Preferences::previewWithPolygonHLR()
+{
+    return getPreferenceGroup("HLR")->GetBool("PreviewWithPolygonHLR", false);
+}
+
@@ -162,6 +162,9 @@ public:
 
     static bool showUnits();
 
+    static int hlrCacheSize();
+    static bool previewWithPolygonHLR();
+
 };
 
 
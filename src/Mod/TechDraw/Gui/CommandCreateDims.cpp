@@ -87,6 +87,7 @@ using DimensionType = TechDraw::DrawViewDimension::DimensionType;
 //internal functions
 bool _checkSelection(Gui::Command* cmd, unsigned maxObjs = 2);
 bool _checkDrawViewPart(Gui::Command* cmd);
+bool _checkPreview(TechDraw::DrawViewPart* dvp);
 
 bool isDimCmdActive(Gui::Command* cmd)
 {
@@ -1426,6 +1427,9 @@ void CmdTechDrawDimension::activated(int iMsg)
     ReferenceVector references3d;
     TechDraw::DrawViewPart* partFeat =
         TechDraw::getReferencesFromSelection(references2d, references3d);
+    if (!_checkPreview(partFeat)) {
+        return;
+    }
 
     activateHandler(new TDHandlerDimension(references2d, partFeat));
 }
@@ -2099,6 +2103,9 @@ void execExtent(Gui::Command* cmd, const std::string& dimType)
     ReferenceVector references3d;
     TechDraw::DrawViewPart* partFeat =
         TechDraw::getReferencesFromSelection(references2d, references3d);
+    if (!_checkPreview(partFeat)) {
+        return;
+    }
 
     // if sticky selection is in use we may get confusing selections that appear to
     // include both 2d and 3d geometry for the extent dim.
@@ -2394,6 +2401,9 @@ void execDim(Gui::Command* cmd, std::string type, StringVector acceptableGeometr
     ReferenceVector references3d;
     TechDraw::DrawViewPart* partFeat =
         TechDraw::getReferencesFromSelection(references2d, references3d);
+    if (!_checkPreview(partFeat)) {
+        return;
+    }
 
     //what 2d geometry configuration did we receive?
     DimensionGeometryType geometryRefs2d = validateDimSelection(
@@ -2583,3 +2593,17 @@ bool _checkDrawViewPart(Gui::Command* cmd)
     }
     return false;
 }
+
+//! dimensions can not be based on the polygon HLR preview, since its geometry indices do not
+//! match the exact result that replaces it
+bool _checkPreview(TechDraw::DrawViewPart* dvp)
+{
+    if (dvp && dvp->isShowingPreview()) {
+        QMessageBox::warning(Gui::getMainWindow(),
+                             QObject::tr("View not ready"),
+                             QObject::tr("The view is still being computed. Try again when the "
+                                         "preview has been replaced by the final geometry."));
+        return false;
+    }
+    return true;
+}
@@ -252,6 +252,17 @@ void QGIViewPart::drawViewPart()
     drawAllEdges();
 
     drawAllVertexes();
+
+    if (viewPart->isShowingPreview()) {
+        // the polygon HLR preview is replaced by the exact result, so nothing may refer to its
+        // edges and vertices.
+        for (auto& child : childItems()) {
+            QGIPrimPath* prim = dynamic_cast<QGIPrimPath*>(child);
+            if (prim) {
+                prim->setFlag(QGraphicsItem::ItemIsSelectable, false);
+            }
+        }
+    }
 }
 
 void QGIViewPart::drawAllFaces(void)
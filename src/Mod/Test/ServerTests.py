@@ -0,0 +1,130 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *   Copyright (c) 2024 The FreeCAD Project Association                    *
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# **************************************************************************/
+
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import unittest
+
+import FreeCAD
+
+
+def serverExecutable():
+    name = "FreeCADCmd.exe" if sys.platform == "win32" else "FreeCADCmd"
+    path = os.path.join(FreeCAD.getHomePath(), "bin", name)
+    return path if os.path.isfile(path) else None
+
+
+class ServerStdinCases(unittest.TestCase):
+    """Test the JSON line protocol of 'FreeCADCmd --server' on stdin/stdout"""
+
+    def setUp(self):
+        executable = serverExecutable()
+        if not executable:
+            self.skipTest("FreeCADCmd not found")
+        self.server = subprocess.Popen(
+            [executable, "--server"],
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.DEVNULL,
+            encoding="utf-8",
+        )
+        # skip anything printed during start up, before the server loop runs
+        self.send({"id": "ready", "script": ""})
+        for line in self.server.stdout:
+            try:
+                if json.loads(line).get("id") == "ready":
+                    break
+            except ValueError:
+                pass
+        else:
+            self.fail("Server did not start")
+
+    def tearDown(self):
+        if self.server.poll() is None:
+            self.server.kill()
+            self.server.wait()
+        self.server.stdin.close()
+        self.server.stdout.close()
+
+    def send(self, request):
+        line = request if isinstance(request, str) else json.dumps(request)
+        self.server.stdin.write(line + "\n")
+        self.server.stdin.flush()
+
+    def request(self, request):
+        self.send(request)
+        # after start up every line on stdout must be a reply
+        return json.loads(self.server.stdout.readline())
+
+    def testScript(self):
+        reply = self.request({"id": 1, "script": "result = args * 2", "args": 21})
+        self.assertEqual(reply, {"id": 1, "ok": True, "result": 42})
+
+    def testFile(self):
+        with tempfile.TemporaryDirectory() as directory:
+            fileName = os.path.join(directory, "job.py")
+            with open(fileName, "w", encoding="utf-8") as f:
+                f.write("result = {'sum': sum(args)}\n")
+            reply = self.request({"id": 2, "file": fileName, "args": [1, 2, 3]})
+        self.assertTrue(reply["ok"])
+        self.assertEqual(reply["result"], {"sum": 6})
+
+    def testOutputIsNotAReply(self):
+        script = "import FreeCAD\nprint('noise')\nFreeCAD.Console.PrintMessage('noise\\n')\n"
+        reply = self.request({"id": 3, "script": script + "result = 'done'"})
+        self.assertEqual(reply, {"id": 3, "ok": True, "result": "done"})
+        reply = self.request({"id": 4, "script": "result = 1"})
+        self.assertEqual(reply["id"], 4)
+
+    def testErrors(self):
+        reply = self.request({"id": 5, "script": "raise ValueError('job failed')"})
+        self.assertEqual(reply["id"], 5)
+        self.assertFalse(reply["ok"])
+        self.assertIn("job failed", reply["error"])
+
+        reply = self.request({"id": 6, "script": "result = object()"})
+        self.assertFalse(reply["ok"])
+
+        reply = self.request("this is not JSON")
+        self.assertIsNone(reply["id"])
+        self.assertFalse(reply["ok"])
+
+        # the server keeps running after failed jobs
+        reply = self.request({"id": 7, "script": "result = True"})
+        self.assertTrue(reply["result"])
+
+    def testJobIsolation(self):
+        script = "import FreeCAD\nFreeCAD.newDocument('ServerJob')\nvalue = 1\n"
+        reply = self.request({"id": 8, "script": script + "result = len(FreeCAD.listDocuments())"})
+        self.assertEqual(reply["result"], 1)
+
+        script = "import FreeCAD\nresult = [len(FreeCAD.listDocuments()), 'value' in globals()]"
+        reply = self.request({"id": 9, "script": script})
+        self.assertEqual(reply["result"], [0, False])
+
+    def testQuit(self):
+        self.send({"command": "quit"})
+        self.assertEqual(self.server.wait(timeout=60), 0)
@@ -0,0 +1,102 @@
+#include <Base/Console.h>
+#include <QCoreApplication>
+#include <QTest>
+#include <string>
+#include <vector>
+
+class RecordingLogger: public Base::ILogger
+{
+public:
+    void SendLog(const std::string& notifiername,
+                 const std::string& msg,
+                 Base::LogStyle level,
+                 Base::IntendedRecipient /*recipient*/,
+                 Base::ContentType /*content*/) override
+    {
+        if (level != Base::LogStyle::Log || notifiername != notifier) {
+            return;
+        }
+        if (msg.find("suppressed") != std::string::npos) {
+            reports.push_back(msg);
+        }
+        else {
+            ++delivered;
+        }
+    }
+
+    std::string notifier;
+    int delivered {0};
+    std::vector<std::string> reports;
+};
+
+class testConsole: public QObject
+{
+    Q_OBJECT
+
+public:
+    testConsole() = default;
+    ~testConsole() override = default;
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        Base::Console().AttachObserver(&logger);
+        Base::Console().SetConnectionMode(Base::ConsoleSingleton::Queued);
+    }
+    void cleanupTestCase()
+    {
+        Base::Console().SetConnectionMode(Base::ConsoleSingleton::Direct);
+        Base::Console().DetachObserver(&logger);
+    }
+
+    void cleanup()
+    {
+        // let the rate limit windows of the previous test expire
+        QTest::qWait(1100);
+        QCoreApplication::processEvents();
+        logger.delivered = 0;
+        logger.reports.clear();
+    }
+
+    void test_SuppressedCountIsReportedWithoutFurtherMessages()
+    {
+        logger.notifier = "testConsole";
+        for (int i = 0; i < 600; i++) {
+            Base::Console().Log(logger.notifier, "message %d\n", i);
+        }
+
+        QCoreApplication::processEvents();
+        QCOMPARE(logger.delivered, 500);
+        QVERIFY(logger.reports.empty());
+
+        // no further message of this notifier arrives, the timer must report the count
+        QTRY_COMPARE_WITH_TIMEOUT(logger.reports.size(), size_t(1), 3000);
+        QCOMPARE(logger.reports.front(), std::string("100 log messages suppressed\n"));
+    }
+
+    void test_NewWindowAfterExpiry()
+    {
+        logger.notifier = "testConsoleWindow";
+        for (int i = 0; i < 501; i++) {
+            Base::Console().Log(logger.notifier, "message %d\n", i);
+        }
+        QCoreApplication::processEvents();
+        QCOMPARE(logger.delivered, 500);
+
+        QTRY_COMPARE_WITH_TIMEOUT(logger.reports.size(), size_t(1), 3000);
+        QCOMPARE(logger.reports.front(), std::string("1 log messages suppressed\n"));
+
+        // the notifier was forgotten, so a new message starts a fresh window
+        Base::Console().Log(logger.notifier, "message\n");
+        QCoreApplication::processEvents();
+        QCOMPARE(logger.delivered, 501);
+        QCOMPARE(logger.reports.size(), size_t(1));
+    }
+
+private:
+    RecordingLogger logger;
+};
+
+QTEST_GUILESS_MAIN(testConsole)
+
+#include "Console.moc"
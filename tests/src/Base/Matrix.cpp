@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
 #include <Base/Matrix.h>
 #include <Base/Rotation.h>
 
@@ -401,5 +404,131 @@ TEST(Matrix, TestRotAxisFormula) //NOLINT
     EXPECT_DOUBLE_EQ(mat1[2][1], mat2[2][1]);
     EXPECT_DOUBLE_EQ(mat1[2][2], mat2[2][2]);
 }
+
+static Base::Matrix4D batchTestMatrix()
+{
+    Base::Matrix4D mat;
+    mat.rotLine(Base::Vector3d(1, 2, 3), 0.7);
+    mat.scale(Base::Vector3d(2, 0.5, 1.5));
+    mat.move(Base::Vector3d(10, -20, 30));
+    return mat;
+}
+
+TEST(Matrix, TestBatchMultVecDouble)
+{
+    Base::Matrix4D mat = batchTestMatrix();
+    std::vector<Base::Vector3d> src;
+    for (int i = 0; i < 100; i++) {
+        src.emplace_back(i, -2.0 * i, 0.5 * i);
+    }
+
+    std::vector<Base::Vector3d> dst(src.size());
+    mat.multVec(src.data(), dst.data(), src.size());
+    for (std::size_t i = 0; i < src.size(); i++) {
+        EXPECT_EQ(dst[i], mat * src[i]);
+    }
+
+    // in place
+    mat.multVec(src.data(), src.data(), src.size());
+    EXPECT_EQ(src, dst);
+}
+
+TEST(Matrix, TestBatchMultVecFloat)
+{
+    Base::Matrix4D mat = batchTestMatrix();
+    std::vector<Base::Vector3f> src;
+    for (int i = 0; i < 100; i++) {
+        src.emplace_back(float(i), -2.0F * float(i), 0.5F * float(i));
+    }
+
+    std::vector<Base::Vector3f> dst(src.size());
+    mat.multVec(src.data(), dst.data(), src.size());
+    for (std::size_t i = 0; i < src.size(); i++) {
+        EXPECT_EQ(dst[i], mat * src[i]);
+    }
+}
+
+TEST(Matrix, TestBatchMultVecSoA)
+{
+    Base::Matrix4D mat = batchTestMatrix();
+    std::vector<double> x, y, z;
+    for (int i = 0; i < 100; i++) {
+        x.push_back(i);
+        y.push_back(-2.0 * i);
+        z.push_back(0.5 * i);
+    }
+
+    mat.multVec(x.data(), y.data(), z.data(), x.size());
+    for (int i = 0; i < 100; i++) {
+        Base::Vector3d pnt = mat * Base::Vector3d(i, -2.0 * i, 0.5 * i);
+        EXPECT_EQ(Base::Vector3d(x[i], y[i], z[i]), pnt);
+    }
+}
+
+TEST(Matrix, TestBatchMultVecLarge)
+{
+    // large enough to be split among threads
+    Base::Matrix4D mat = batchTestMatrix();
+    std::vector<Base::Vector3d> src;
+    for (int i = 0; i < 500000; i++) {
+        src.emplace_back(i, -2.0 * i, 0.5 * i);
+    }
+
+    std::vector<Base::Vector3d> dst(src.size());
+    mat.multVec(src.data(), dst.data(), src.size());
+    for (std::size_t i = 0; i < src.size(); i += 997) {
+        EXPECT_EQ(dst[i], mat * src[i]);
+    }
+    EXPECT_EQ(dst.back(), mat * src.back());
+}
+
+TEST(Matrix, TestBatchMultVecStrided)
+{
+    // a point with extra members like MeshCore::MeshPoint
+    struct Point: Base::Vector3f
+    {
+        unsigned char flag {0};
+        unsigned long prop {0};
+    };
+
+    Base::Matrix4D mat = batchTestMatrix();
+    std::vector<Point> points(200000);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        points[i].Set(float(i), -2.0F * float(i), 0.5F * float(i));
+        points[i].prop = static_cast<unsigned long>(i);
+    }
+
+    Base::Vector3f* data = points.data();
+    mat.multVec(data, points.size(), sizeof(Point));
+    for (std::size_t i = 0; i < points.size(); i += 997) {
+        Base::Vector3f pnt(float(i), -2.0F * float(i), 0.5F * float(i));
+        EXPECT_EQ(static_cast<const Base::Vector3f&>(points[i]), mat * pnt);
+        EXPECT_EQ(points[i].prop, static_cast<unsigned long>(i));
+    }
+}
+
+TEST(Matrix, BenchmarkBatchMultVec)
+{
+    Base::Matrix4D mat = batchTestMatrix();
+    std::vector<Base::Vector3d> single;
+    for (int i = 0; i < 1000000; i++) {
+        single.emplace_back(i, -2.0 * i, 0.5 * i);
+    }
+    std::vector<Base::Vector3d> batch(single);
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto& pnt : single) {
+        mat.multVec(pnt, pnt);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    mat.multVec(batch.data(), batch.data(), batch.size());
+    auto end = std::chrono::steady_clock::now();
+
+    // the timings are kept in the XML report, e.g. with --gtest_output=xml
+    using ms = std::chrono::duration<double, std::milli>;
+    RecordProperty("single_ms", std::to_string(ms(middle - start).count()));
+    RecordProperty("batch_ms", std::to_string(ms(end - middle).count()));
+    EXPECT_EQ(single, batch);
+}
 // clang-format on
 // NOLINTEND(cppcoreguidelines-*,readability-magic-numbers)
@@ -250,6 +250,30 @@ TEST_F(ParameterTest, TestString)
     EXPECT_EQ(grp->GetASCIIs().size(), 1);
 }
 
+TEST_F(ParameterTest, TestCachedValues)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    EXPECT_EQ(grp->GetFloat("Float", 1.0), 1.0);
+    EXPECT_EQ(grp->GetASCII("String", "Default"), "Default");
+
+    grp->SetFloat("Float", 2.0);
+    grp->SetASCII("String", "Value");
+    EXPECT_EQ(grp->GetFloat("Float", 1.0), 2.0);
+    EXPECT_EQ(grp->GetASCII("String", "Default"), "Value");
+
+    grp->RemoveFloat("Float");
+    EXPECT_EQ(grp->GetFloat("Float", 1.0), 1.0);
+
+    grp->Clear();
+    EXPECT_EQ(grp->GetASCII("String", "Default"), "Default");
+
+    grp->SetBool("Bool", true);
+    grp->SetInt("Bool", 3);
+    EXPECT_EQ(grp->GetBool("Bool", false), true);
+    EXPECT_EQ(grp->GetInt("Bool", 0), 3);
+}
+
 TEST_F(ParameterTest, TestCopy)
 {
     auto cfg = getCreateConfig();
@@ -25,6 +25,25 @@ TEST(BaseQuantity, TestParse)
     EXPECT_THROW(boost::ignore_unused(Base::Quantity::parse("1,234,500.12 kg")), Base::ParserError);
 }
 
+TEST(BaseQuantity, TestParseNumberWithUnit)
+{
+    EXPECT_EQ(Base::Quantity::parse("2 mm"), Base::Quantity(2.0, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse("2mm"), Base::Quantity(2.0, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse(" - 1.5e1 cm "), Base::Quantity(-150.0, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse(".5 kg"), Base::Quantity(0.5, Base::Unit::Mass));
+    EXPECT_EQ(Base::Quantity::parse("10 \xC2\xB5m"), Base::Quantity(0.01, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse("1 in"), Base::Quantity(25.4, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse("1\""), Base::Quantity(25.4, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse("42"), Base::Quantity(42.0));
+
+    // not handled by the fast path
+    EXPECT_EQ(Base::Quantity::parse("2 mm^2"), Base::Quantity(2.0, Base::Unit::Area));
+    EXPECT_EQ(Base::Quantity::parse("1 m 20 cm"), Base::Quantity(1200.0, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse("1,5 kg"), Base::Quantity(1.5, Base::Unit::Mass));
+    EXPECT_THROW(boost::ignore_unused(Base::Quantity::parse("2 mmx")), Base::ParserError);
+    EXPECT_THROW(boost::ignore_unused(Base::Quantity::parse("2e")), Base::ParserError);
+}
+
 TEST(BaseQuantity, TestDim)
 {
     Base::Quantity q1 {0, Base::Unit::Area};
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Approximation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class ApproximationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // points on the plane z = 0.5 * x - 0.25 * y + 3 with some noise
+        for (int i = 0; i < 50; i++) {
+            for (int j = 0; j < 50; j++) {
+                float x = float(i);
+                float y = float(j);
+                float z = 0.5F * x - 0.25F * y + 3.0F + ((i + j) % 2 == 0 ? 0.01F : -0.01F);
+                points.emplace_back(x, y, z);
+            }
+        }
+    }
+
+    void TearDown() override
+    {}
+
+    const std::vector<Base::Vector3f>& GetPoints() const
+    {
+        return points;
+    }
+
+private:
+    std::vector<Base::Vector3f> points;
+};
+
+TEST_F(ApproximationTest, TestMoments)
+{
+    MeshCore::PointMoments single;
+    for (const auto& it : GetPoints()) {
+        single.Add(it);
+    }
+
+    MeshCore::PointMoments batch;
+    batch.Add(GetPoints().data(), GetPoints().size());
+
+    EXPECT_EQ(single.count, batch.count);
+    EXPECT_DOUBLE_EQ(single.sx, batch.sx);
+    EXPECT_DOUBLE_EQ(single.sxy, batch.sxy);
+    EXPECT_DOUBLE_EQ(single.szz, batch.szz);
+    EXPECT_DOUBLE_EQ(single.Mean().x, 24.5);
+    EXPECT_DOUBLE_EQ(single.Mean().y, 24.5);
+}
+
+TEST_F(ApproximationTest, TestMomentsLarge)
+{
+    // large enough to be summed up in parallel
+    std::vector<Base::Vector3f> large;
+    for (int i = 0; i < 200; i++) {
+        large.insert(large.end(), GetPoints().begin(), GetPoints().end());
+    }
+
+    MeshCore::PointMoments moments;
+    moments.Add(large.data(), large.size());
+
+    MeshCore::PointMoments expected;
+    expected.Add(GetPoints().data(), GetPoints().size());
+
+    EXPECT_EQ(moments.count, 200 * expected.count);
+    EXPECT_NEAR(moments.sx, 200 * expected.sx, 1e-6 * moments.sx);
+    EXPECT_NEAR(moments.syz, 200 * expected.syz, 1e-6 * std::abs(moments.syz));
+    EXPECT_NEAR(moments.Mean().z, expected.Mean().z, 1e-9);
+}
+
+TEST_F(ApproximationTest, TestPlaneFitIncremental)
+{
+    MeshCore::PlaneFit all;
+    all.AddPoints(GetPoints());
+    float result = all.Fit();
+
+    // grow the point set and re-fit as done by the region growing
+    MeshCore::PlaneFit growing;
+    for (const auto& it : GetPoints()) {
+        growing.AddPoint(it);
+        if (growing.CountPoints() >= 3) {
+            growing.Fit();
+        }
+    }
+
+    EXPECT_EQ(growing.CountPoints(), all.CountPoints());
+    EXPECT_FLOAT_EQ(growing.Fit(), result);
+    Base::Vector3f normal(0.5F, -0.25F, -1.0F);
+    normal.Normalize();
+    EXPECT_NEAR(std::abs(all.GetNormal() * normal), 1.0F, 1e-5F);
+    EXPECT_EQ(growing.GetGravity(), all.GetGravity());
+}
+
+TEST_F(ApproximationTest, TestPlaneFitProject)
+{
+    MeshCore::PlaneFit fit;
+    fit.AddPoints(GetPoints());
+    fit.Fit();
+    fit.ProjectToPlane();
+
+    MeshCore::PlaneFit projected;
+    projected.AddPoints(fit.GetPoints());
+    EXPECT_EQ(fit.GetMoments().count, projected.GetMoments().count);
+    EXPECT_DOUBLE_EQ(fit.GetMoments().szz, projected.GetMoments().szz);
+    EXPECT_LT(projected.Fit(), 1e-4F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
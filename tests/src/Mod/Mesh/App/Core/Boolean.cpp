@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <Base/Matrix.h>
+#include <Mod/Mesh/App/Core/Boolean.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class BooleanTest: public ::testing::Test
+{
+protected:
+    // Unit cube at the given position with each side split into a grid of num x num squares
+    static MeshCore::MeshKernel CreateCube(const Base::Vector3f& pos, int num)
+    {
+        return MeshTestHelpers::createCube(pos, 1.0F, num);
+    }
+
+    static double Volume(const MeshCore::MeshKernel& kernel)
+    {
+        double volume = 0.0;
+        const MeshCore::MeshPointArray& points = kernel.GetPoints();
+        for (const auto& it : kernel.GetFacets()) {
+            Base::Vector3d p0 = Base::toVector<double>(points[it._aulPoints[0]]);
+            Base::Vector3d p1 = Base::toVector<double>(points[it._aulPoints[1]]);
+            Base::Vector3d p2 = Base::toVector<double>(points[it._aulPoints[2]]);
+            volume += p0 * (p1 % p2) / 6.0;
+        }
+        return volume;
+    }
+
+    static bool IsClosed(const MeshCore::MeshKernel& kernel)
+    {
+        for (const auto& it : kernel.GetFacets()) {
+            for (auto neighbour : it._aulNeighbours) {
+                if (neighbour == MeshCore::FACET_INDEX_MAX) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static MeshCore::MeshKernel Compute(const MeshCore::MeshKernel& mesh1,
+                                        const MeshCore::MeshKernel& mesh2,
+                                        MeshCore::SetOperations::OperationType type)
+    {
+        MeshCore::MeshKernel result;
+        MeshCore::MeshBoolean boolean(mesh1, mesh2, result, type);
+        boolean.Do();
+        return result;
+    }
+};
+
+TEST_F(BooleanTest, testUnion)
+{
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 1);
+    auto cube2 = CreateCube(Base::Vector3f(0.5F, 0.5F, 0.5F), 1);
+    auto result = Compute(cube1, cube2, MeshCore::SetOperations::Union);
+    EXPECT_TRUE(IsClosed(result));
+    EXPECT_NEAR(Volume(result), 1.875, 1e-5);
+}
+
+TEST_F(BooleanTest, testIntersect)
+{
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 1);
+    auto cube2 = CreateCube(Base::Vector3f(0.5F, 0.5F, 0.5F), 1);
+    auto result = Compute(cube1, cube2, MeshCore::SetOperations::Intersect);
+    EXPECT_TRUE(IsClosed(result));
+    EXPECT_NEAR(Volume(result), 0.125, 1e-5);
+}
+
+TEST_F(BooleanTest, testDifference)
+{
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 1);
+    auto cube2 = CreateCube(Base::Vector3f(0.5F, 0.5F, 0.5F), 1);
+    auto result = Compute(cube1, cube2, MeshCore::SetOperations::Difference);
+    EXPECT_TRUE(IsClosed(result));
+    EXPECT_NEAR(Volume(result), 0.875, 1e-5);
+}
+
+TEST_F(BooleanTest, testFineGrid)
+{
+    // the planes of one cube pass through points and edges of the other
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 8);
+    auto cube2 = CreateCube(Base::Vector3f(0.5F, 0.25F, 0.125F), 8);
+    auto result = Compute(cube1, cube2, MeshCore::SetOperations::Union);
+    EXPECT_TRUE(IsClosed(result));
+    EXPECT_NEAR(Volume(result), 2.0 - 0.5 * 0.75 * 0.875, 1e-5);
+
+    result = Compute(cube1, cube2, MeshCore::SetOperations::Difference);
+    EXPECT_TRUE(IsClosed(result));
+    EXPECT_NEAR(Volume(result), 1.0 - 0.5 * 0.75 * 0.875, 1e-5);
+}
+
+TEST_F(BooleanTest, testGeneralPosition)
+{
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 5);
+    auto cube2 = CreateCube(Base::Vector3f(0.31F, 0.27F, 0.43F), 7);
+    auto result = Compute(cube1, cube2, MeshCore::SetOperations::Intersect);
+    EXPECT_TRUE(IsClosed(result));
+    EXPECT_NEAR(Volume(result), 0.69 * 0.73 * 0.57, 1e-5);
+}
+
+TEST_F(BooleanTest, testRotated)
+{
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 4);
+    auto cube2 = CreateCube(Base::Vector3f(-0.5F, -0.5F, -0.5F), 5);
+    Base::Matrix4D mat;
+    mat.rotX(0.3);
+    mat.rotY(0.5);
+    mat.rotZ(0.7);
+    mat.move(Base::Vector3d(0.6, 0.55, 0.5));
+    cube2.Transform(mat);
+
+    auto unite = Compute(cube1, cube2, MeshCore::SetOperations::Union);
+    auto intersect = Compute(cube1, cube2, MeshCore::SetOperations::Intersect);
+    auto difference = Compute(cube1, cube2, MeshCore::SetOperations::Difference);
+    EXPECT_TRUE(IsClosed(unite));
+    EXPECT_TRUE(IsClosed(intersect));
+    EXPECT_TRUE(IsClosed(difference));
+    EXPECT_NEAR(Volume(unite) + Volume(intersect), 2.0, 1e-5);
+    EXPECT_NEAR(Volume(difference) + Volume(intersect), 1.0, 1e-5);
+}
+
+TEST_F(BooleanTest, testDisjoint)
+{
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 2);
+    auto cube2 = CreateCube(Base::Vector3f(2.0F, 0.0F, 0.0F), 2);
+    auto result = Compute(cube1, cube2, MeshCore::SetOperations::Union);
+    EXPECT_EQ(result.CountFacets(), cube1.CountFacets() + cube2.CountFacets());
+    EXPECT_NEAR(Volume(result), 2.0, 1e-5);
+
+    result = Compute(cube1, cube2, MeshCore::SetOperations::Intersect);
+    EXPECT_EQ(result.CountFacets(), 0);
+}
+
+TEST_F(BooleanTest, testFlushFaces)
+{
+    // the front, back, bottom and top faces of both cubes overlap
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 2);
+    auto cube2 = CreateCube(Base::Vector3f(0.5F, 0.0F, 0.0F), 3);
+
+    auto unite = Compute(cube1, cube2, MeshCore::SetOperations::Union);
+    EXPECT_TRUE(IsClosed(unite));
+    EXPECT_NEAR(Volume(unite), 1.5, 1e-5);
+
+    auto intersect = Compute(cube1, cube2, MeshCore::SetOperations::Intersect);
+    EXPECT_TRUE(IsClosed(intersect));
+    EXPECT_NEAR(Volume(intersect), 0.5, 1e-5);
+
+    auto difference = Compute(cube1, cube2, MeshCore::SetOperations::Difference);
+    EXPECT_TRUE(IsClosed(difference));
+    EXPECT_NEAR(Volume(difference), 0.5, 1e-5);
+}
+
+TEST_F(BooleanTest, testTouchingFaces)
+{
+    // the right face of the first cube lies on the left face of the second cube
+    auto cube1 = CreateCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 2);
+    auto cube2 = CreateCube(Base::Vector3f(1.0F, 0.25F, 0.25F), 1);
+
+    auto unite = Compute(cube1, cube2, MeshCore::SetOperations::Union);
+    EXPECT_TRUE(IsClosed(unite));
+    EXPECT_NEAR(Volume(unite), 2.0, 1e-5);
+
+    auto difference = Compute(cube1, cube2, MeshCore::SetOperations::Difference);
+    EXPECT_TRUE(IsClosed(difference));
+    EXPECT_NEAR(Volume(difference), 1.0, 1e-5);
+
+    auto intersect = Compute(cube1, cube2, MeshCore::SetOperations::Intersect);
+    EXPECT_NEAR(Volume(intersect), 0.0, 1e-5);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <vector>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include "MeshTestHelpers.h"
+
+namespace MeshTestHelpers
+{
+
+MeshCore::MeshKernel createCube(const Base::Vector3f& pos, float len, int num)
+{
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    auto addQuad = [&facets, &pos](const Base::Vector3f& p1,
+                                   const Base::Vector3f& p2,
+                                   const Base::Vector3f& p3,
+                                   const Base::Vector3f& p4) {
+        facets.emplace_back(p1 + pos, p2 + pos, p3 + pos);
+        facets.emplace_back(p1 + pos, p3 + pos, p4 + pos);
+    };
+
+    float step = len / float(num);
+    for (int i = 0; i < num; i++) {
+        for (int j = 0; j < num; j++) {
+            float u0 = float(i) * step;
+            float u1 = float(i + 1) * step;
+            float v0 = float(j) * step;
+            float v1 = float(j + 1) * step;
+            addQuad(Base::Vector3f(u0, v0, 0.0F),
+                    Base::Vector3f(u0, v1, 0.0F),
+                    Base::Vector3f(u1, v1, 0.0F),
+                    Base::Vector3f(u1, v0, 0.0F));
+            addQuad(Base::Vector3f(u0, v0, len),
+                    Base::Vector3f(u1, v0, len),
+                    Base::Vector3f(u1, v1, len),
+                    Base::Vector3f(u0, v1, len));
+            addQuad(Base::Vector3f(u0, 0.0F, v0),
+                    Base::Vector3f(u1, 0.0F, v0),
+                    Base::Vector3f(u1, 0.0F, v1),
+                    Base::Vector3f(u0, 0.0F, v1));
+            addQuad(Base::Vector3f(u0, len, v0),
+                    Base::Vector3f(u0, len, v1),
+                    Base::Vector3f(u1, len, v1),
+                    Base::Vector3f(u1, len, v0));
+            addQuad(Base::Vector3f(0.0F, u0, v0),
+                    Base::Vector3f(0.0F, u0, v1),
+                    Base::Vector3f(0.0F, u1, v1),
+                    Base::Vector3f(0.0F, u1, v0));
+            addQuad(Base::Vector3f(len, u0, v0),
+                    Base::Vector3f(len, u1, v0),
+                    Base::Vector3f(len, u1, v1),
+                    Base::Vector3f(len, u0, v1));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+    return kernel;
+}
+
+}  // namespace MeshTestHelpers
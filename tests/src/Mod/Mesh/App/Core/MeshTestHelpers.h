@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <Base/Vector3D.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+namespace MeshTestHelpers
+{
+
+// Axis-aligned cube with the given corner and side length, each side split into a grid of
+// num x num squares
+MeshCore::MeshKernel createCube(const Base::Vector3f& pos, float len, int num);
+
+}  // namespace MeshTestHelpers
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <Mod/Mesh/App/Core/Segmentation.h>
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SegmentationTest: public ::testing::Test
+{
+protected:
+    // Cube with each side split into a grid of num x num squares
+    static MeshCore::MeshKernel CreateBox(int num)
+    {
+        return MeshTestHelpers::createCube(Base::Vector3f(0.0F, 0.0F, 0.0F), 10.0F, num);
+    }
+
+    // Open cylinder around the z-axis
+    static MeshCore::MeshKernel CreateTube(float radius, int sides, int rows)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        const float pi = 3.14159265F;
+        for (int i = 0; i < sides; i++) {
+            float a0 = 2.0F * pi * float(i) / float(sides);
+            float a1 = 2.0F * pi * float(i + 1) / float(sides);
+            for (int j = 0; j < rows; j++) {
+                Base::Vector3f p1(radius * std::cos(a0), radius * std::sin(a0), float(j));
+                Base::Vector3f p2(radius * std::cos(a1), radius * std::sin(a1), float(j));
+                Base::Vector3f p3(radius * std::cos(a1), radius * std::sin(a1), float(j + 1));
+                Base::Vector3f p4(radius * std::cos(a0), radius * std::sin(a0), float(j + 1));
+                facets.emplace_back(p1, p2, p3);
+                facets.emplace_back(p1, p3, p4);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static MeshCore::MeshSurfaceSegmentPtr
+    CreateSegment(MeshCore::AbstractSurfaceFit* fit, const MeshCore::MeshKernel& kernel, float tol)
+    {
+        return std::make_shared<MeshCore::MeshDistanceGenericSurfaceFitSegment>(fit,
+                                                                               kernel,
+                                                                               10,
+                                                                               tol);
+    }
+};
+
+TEST_F(SegmentationTest, TestRansacPlanes)
+{
+    MeshCore::MeshKernel kernel = CreateBox(10);
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
+    segm.push_back(CreateSegment(new MeshCore::PlaneSurfaceFit, kernel, 0.01F));
+
+    MeshCore::MeshRansacSegmentAlgorithm finder(kernel);
+    finder.FindSegments(segm);
+
+    const std::vector<MeshCore::MeshSegment>& planes = segm.front()->GetSegments();
+    EXPECT_EQ(planes.size(), 6);
+    for (const auto& it : planes) {
+        EXPECT_EQ(it.size(), 200);
+    }
+}
+
+TEST_F(SegmentationTest, TestRansacCylinder)
+{
+    MeshCore::MeshKernel kernel = CreateTube(5.0F, 64, 20);
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
+    segm.push_back(CreateSegment(new MeshCore::CylinderSurfaceFit, kernel, 0.05F));
+    segm.push_back(CreateSegment(new MeshCore::SphereSurfaceFit, kernel, 0.05F));
+
+    MeshCore::MeshRansacSegmentAlgorithm finder(kernel);
+    finder.FindSegments(segm);
+
+    const std::vector<MeshCore::MeshSegment>& cylinders = segm[0]->GetSegments();
+    ASSERT_EQ(cylinders.size(), 1);
+    EXPECT_EQ(cylinders.front().size(), kernel.CountFacets());
+    EXPECT_TRUE(segm[1]->GetSegments().empty());
+}
+
+TEST_F(SegmentationTest, TestRansacSameAsRegionGrowing)
+{
+    MeshCore::MeshKernel kernel = CreateBox(4);
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> ransac;
+    ransac.push_back(CreateSegment(new MeshCore::PlaneSurfaceFit, kernel, 0.01F));
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> growing;
+    growing.push_back(CreateSegment(new MeshCore::PlaneSurfaceFit, kernel, 0.01F));
+
+    MeshCore::MeshRansacSegmentAlgorithm(kernel).FindSegments(ransac);
+    MeshCore::MeshSegmentAlgorithm(kernel).FindSegments(growing);
+
+    auto sorted = [](std::vector<MeshCore::MeshSegment> segments) {
+        for (auto& it : segments) {
+            std::sort(it.begin(), it.end());
+        }
+        std::sort(segments.begin(), segments.end());
+        return segments;
+    };
+    EXPECT_EQ(sorted(ransac.front()->GetSegments()), sorted(growing.front()->GetSegments()));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)